@@ -0,0 +1,514 @@
+#include "Program.hpp"
+#include "Execution.hpp"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <streambuf>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef BF_BENCH_DIR
+#define BF_BENCH_DIR "bench"
+#endif
+
+namespace
+{
+
+struct Benchmark
+{
+
+    const char *name;
+    // Bytes of generated input, 0 for programs that read nothing
+    std::size_t inputSize;
+
+};
+
+const Benchmark benchmarks[] =
+{
+
+    {"mandelbrot",0},
+    {"hanoi",0},
+    {"primes",0},
+    {"output",0},
+    {"input",std::size_t(4) << 20}
+
+};
+
+/*
+
+Receives the output of a benchmark. Nothing reaches the terminal, the output is only
+counted and hashed (FNV-1a) so runs of different builds can be checked for the same result.
+
+*/
+class OutputDigest : public std::streambuf
+{
+
+public:
+
+    OutputDigest():mSize(0),mHash(14695981039346656037ull){}
+
+    std::uint64_t size() const { return mSize; }
+    std::uint64_t hash() const { return mHash; }
+
+protected:
+
+    int_type overflow(int_type ch) override
+    {
+
+        if(!traits_type::eq_int_type(ch,traits_type::eof()))
+        {
+
+            const char byte = traits_type::to_char_type(ch);
+            xsputn(&byte,1);
+
+        }
+
+        return traits_type::not_eof(ch);
+
+    }
+
+    std::streamsize xsputn(const char *data,std::streamsize size) override
+    {
+
+        for(std::streamsize i = 0; i < size; ++i)
+            mHash = (mHash ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+
+        mSize += size;
+
+        return size;
+
+    }
+
+private:
+
+    std::uint64_t mSize;
+    std::uint64_t mHash;
+
+};
+
+// Lines of pseudo random lowercase words, the same on every run and without zero bytes
+std::string generateInput(std::size_t size)
+{
+
+    std::string text;
+    std::uint32_t state = 12345;
+
+    text.reserve(size);
+
+    while(text.size() < size)
+    {
+
+        state = state * 1103515245u + 12345u;
+        const std::uint32_t random = state >> 16;
+
+        if(random % 61 == 0)
+            text += '\n';
+
+        else if(random % 7 == 0)
+            text += ' ';
+
+        else
+            text += static_cast<char>('a' + random % 26);
+
+    }
+
+    return text;
+
+}
+
+struct Statistics
+{
+
+    double median;
+    double min;
+
+};
+
+Statistics statistics(std::vector <double> samples)
+{
+
+    std::sort(samples.begin(),samples.end());
+
+    const std::size_t middle = samples.size() / 2;
+    const double median = samples.size() % 2 ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2;
+
+    return {median,samples.front()};
+
+}
+
+struct Result
+{
+
+    std::string name;
+    std::uint64_t outputSize;
+    std::uint64_t outputHash;
+    Statistics parse;
+    Statistics optimize;
+    Statistics execute;
+    Statistics total;
+
+};
+
+const char *engineName(Interpreter::Engine engine)
+{
+
+    switch(engine)
+    {
+
+    case Interpreter::Engine::switchDispatch:
+        return "switch";
+
+    case Interpreter::Engine::threaded:
+        return "threaded";
+
+    case Interpreter::Engine::jit:
+        return "jit";
+
+    case Interpreter::Engine::tiered:
+        return "tiered";
+
+    }
+
+    return "unknown";
+
+}
+
+}
+
+
+class Bench
+{
+
+public:
+
+    Bench():mHelp(false),mRepetitions(5),mDirectory(BF_BENCH_DIR),mResultsFile("bench-results.json")
+    {}
+
+    void run(int argc,char *argv[])
+    {
+
+        parseArgs(argc,argv);
+
+        if(mHelp)
+        {
+
+            displayHelp();
+            return;
+
+        }
+
+        std::vector <Result> results;
+
+        std::cout << std::setw(12) << std::left << "program" << std::right;
+
+        for(const char *phase : {"parse","optimize","execute","total"})
+            std::cout << std::setw(22) << std::string(phase) + " median/min";
+
+        std::cout << "\n";
+
+        for(const Benchmark &benchmark : benchmarks)
+        {
+
+            results.push_back(measure(benchmark));
+            print(results.back());
+
+        }
+
+        writeResults(results);
+
+        std::cout << "Results written to " << mResultsFile << "\n";
+
+    }
+
+private:
+
+    Result measure(const Benchmark &benchmark)
+    {
+
+        const SourceFile sourceFile(mDirectory + "/" + benchmark.name + ".b");
+        const std::string inputText = generateInput(benchmark.inputSize);
+        std::vector <double> parse, optimize, execute, total;
+        Result result;
+
+        result.name = benchmark.name;
+
+        for(int i = 0; i < mRepetitions; ++i)
+        {
+
+            OutputDigest digest;
+            std::ostream stream(&digest);
+
+            const Program program(sourceFile,mOptions);
+            Execution execution(program,InputSource::fromString(inputText),
+                                std::unique_ptr<OutputSink>(new OutputSink(stream,OutputSink::FlushPolicy::full)));
+
+            execution.run();
+
+            const Interpreter::PhaseTimes &times = program.compileTimes();
+
+            parse.push_back(times.parse);
+            optimize.push_back(times.optimize);
+            execute.push_back(execution.runTime());
+            total.push_back(times.parse + times.optimize + execution.runTime());
+
+            // Every repetition has to produce the same output
+            if(i && (digest.size() != result.outputSize || digest.hash() != result.outputHash))
+                throw std::runtime_error(std::string("Output of ") + benchmark.name + " differs between repetitions");
+
+            result.outputSize = digest.size();
+            result.outputHash = digest.hash();
+
+        }
+
+        result.parse = statistics(parse);
+        result.optimize = statistics(optimize);
+        result.execute = statistics(execute);
+        result.total = statistics(total);
+
+        return result;
+
+    }
+
+    void print(const Result &result)
+    {
+
+        std::cout << std::setw(12) << std::left << result.name << std::right << std::fixed << std::setprecision(2);
+
+        for(const Statistics *phase : {&result.parse,&result.optimize,&result.execute,&result.total})
+            std::cout << std::setw(12) << phase->median * 1000 << " /" << std::setw(8) << phase->min * 1000;
+
+        std::cout << "  ms\n";
+
+    }
+
+    void writeResults(const std::vector <Result> &results)
+    {
+
+        std::ofstream file(mResultsFile);
+
+        if(!file)
+            throw std::runtime_error("Unable to open file " + mResultsFile);
+
+        const auto phase = [&](const char *name,const Statistics &times)
+        {
+
+            file << "      \"" << name << "\": {\"median\": " << times.median << ", \"min\": " << times.min << "}";
+
+        };
+
+        file << std::setprecision(9);
+        file << "{\n";
+        file << "  \"engine\": \"" << engineName(mOptions.engine) << "\",\n";
+        file << "  \"cellBits\": " << mOptions.cellBits << ",\n";
+        file << "  \"optLevel\": " << mOptions.optLevel << ",\n";
+        file << "  \"repetitions\": " << mRepetitions << ",\n";
+        file << "  \"unit\": \"seconds\",\n";
+        file << "  \"benchmarks\": [\n";
+
+        for(std::size_t i = 0; i < results.size(); ++i)
+        {
+
+            const Result &result = results[i];
+
+            file << "    {\n";
+            file << "      \"name\": \"" << result.name << "\",\n";
+            file << "      \"outputBytes\": " << result.outputSize << ",\n";
+            file << "      \"outputHash\": \"" << std::hex << std::setw(16) << std::setfill('0') << result.outputHash
+                 << std::dec << std::setfill(' ') << "\",\n";
+            phase("parse",result.parse);
+            file << ",\n";
+            phase("optimize",result.optimize);
+            file << ",\n";
+            phase("execute",result.execute);
+            file << ",\n";
+            phase("total",result.total);
+            file << "\n    }" << (i + 1 < results.size() ? "," : "") << "\n";
+
+        }
+
+        file << "  ]\n";
+        file << "}\n";
+
+        if(!file)
+            throw std::runtime_error("Unable to write file " + mResultsFile);
+
+    }
+
+    bool strToInt(const std::string &str,int &n)
+    {
+
+        bool success = true;
+
+        try
+        {
+
+            n = std::stoi(str);
+
+        }
+        catch(...)
+        {
+            success = false;
+        }
+
+        return success;
+
+    }
+
+    void displayHelp()
+    {
+
+        const std::string options[][2]=
+        {
+
+            { "-r <count>","Repetitions of every program, default 5"},
+            { "-c <bits>","Specify cell size (16, 32, 64), default 32"},
+            { "-e <engine>","Specify execution engine (switch, threaded, jit, tiered)"},
+            { "-O<level>","Optimization level (0, 1, 2, 3), default 3"},
+            { "-o <file>","Results file, default bench-results.json"}
+
+        };
+
+        std::cout << "Usage: bf-bench [directory] [options]\n";
+        std::cout << "Runs the programs of the benchmark directory, default " << BF_BENCH_DIR << "\n";
+        std::cout << "options: \n";
+
+        for(const auto &option : options)
+            std::cout << std::setw(20) << std::left << option[0] << option[1]<<"\n";
+
+    }
+
+    void parseArgs(int argc,char *argv[])
+    {
+
+        for(int i = 1; i < argc; ++i)
+        {
+
+            if(argv[i][0] == '-' && argv[i][1] == 'O')
+            {
+
+                const char level = argv[i][2];
+
+                if(level < '0' || level > static_cast<char>('0' + Interpreter::maxOptLevel) || argv[i][3] != '\0')
+                    throw std::runtime_error(std::string("Invalid optimization level ") + argv[i]);
+
+                mOptions.optLevel = level - '0';
+
+            }
+
+            else if(argv[i][0] == '-' && argv[i][1] != '\0' && argv[i][2] == '\0')
+            {
+
+                const char option = argv[i][1];
+
+                if(option == 'h')
+                {
+
+                    mHelp = true;
+                    return;
+
+                }
+
+                if(i + 1 == argc)
+                    throw std::runtime_error(std::string("Missing value after '") + argv[i] + "'");
+
+                const std::string value = argv[++i];
+
+                switch(option)
+                {
+
+                case 'r':
+
+                    if(!strToInt(value,mRepetitions) || mRepetitions <= 0)
+                        throw std::runtime_error("Invalid repetitions " + value);
+
+                    break;
+
+                case 'c':
+                {
+
+                    int cellBits;
+
+                    // The corpus counts past 255
+                    if(!strToInt(value,cellBits) || cellBits <= 8 || !Interpreter::validCellBits(cellBits))
+                        throw std::runtime_error("Invalid cell size " + value);
+
+                    mOptions.cellBits = cellBits;
+
+                    break;
+
+                }
+
+                case 'e':
+
+                    if(value == "switch")
+                        mOptions.engine = Interpreter::Engine::switchDispatch;
+
+                    else if(value == "threaded")
+                        mOptions.engine = Interpreter::Engine::threaded;
+
+                    else if(value == "jit")
+                        mOptions.engine = Interpreter::Engine::jit;
+
+                    else if(value == "tiered")
+                        mOptions.engine = Interpreter::Engine::tiered;
+
+                    else
+                        throw std::runtime_error("Invalid engine " + value);
+
+                    break;
+
+                case 'o':
+
+                    mResultsFile = value;
+
+                    break;
+
+                default:
+
+                    throw std::runtime_error(std::string("Invalid option ") + argv[i - 1]);
+
+                }
+
+            }
+
+            else
+                mDirectory = argv[i];
+
+        }
+
+    }
+
+    bool mHelp;
+    int mRepetitions;
+    std::string mDirectory;
+    std::string mResultsFile;
+    Interpreter::Options mOptions;
+
+};
+
+
+int main(int argc,char *argv[])
+{
+
+    try
+    {
+
+        Bench bench;
+        bench.run(argc,argv);
+
+    }
+    catch(const std::exception &ex)
+    {
+
+        std::cerr << "Error: " << ex.what() << "\n";
+        return 1;
+
+    }
+
+    return 0;
+}
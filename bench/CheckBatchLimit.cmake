@@ -0,0 +1,31 @@
+# Runs a batch whose records never finish, once with a time limit and once with a step limit,
+# and checks that bf exits with the status of a run over its limit. ctest runs it, see CMakeLists.txt
+#
+# cmake -DBF=<bf> -DWORK_DIR=<scratch dir> -P CheckBatchLimit.cmake
+
+foreach(variable BF WORK_DIR)
+
+    if(NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not set")
+    endif()
+
+endforeach()
+
+# Same as limitExceededStatus in src/Main.cpp
+set(limitStatus 124)
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(WRITE ${WORK_DIR}/loop.b "+[]")
+file(WRITE ${WORK_DIR}/records.txt "a\nb\nc\n")
+
+foreach(limit "--timeout;0.2" "--max-steps;1000")
+
+    execute_process(COMMAND ${BF} ${WORK_DIR}/loop.b --batch ${WORK_DIR}/records.txt ${limit}
+        RESULT_VARIABLE result ERROR_VARIABLE errors TIMEOUT 60)
+
+    if(NOT result EQUAL limitStatus)
+        message(FATAL_ERROR "${limit}: bf exited with ${result} instead of ${limitStatus}\n${errors}")
+    endif()
+
+    message(STATUS "${limit}: exit status ${result}")
+
+endforeach()
@@ -0,0 +1,58 @@
+# Compiles the C that bf emits for every program in bench/ and checks that it prints
+# what bf prints, for 8 and 32 bit cells. ctest runs it, see CMakeLists.txt
+#
+# cmake -DBF=<bf> -DCC=<c compiler> -DBENCH_DIR=<bench/> -DWORK_DIR=<scratch dir> -P CheckEmitC.cmake
+
+foreach(variable BF CC BENCH_DIR WORK_DIR)
+
+    if(NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not set")
+    endif()
+
+endforeach()
+
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(GLOB programs ${BENCH_DIR}/*.b)
+# input.b counts lines and bytes, any text without zero bytes does
+set(input ${BENCH_DIR}/Bench.cpp)
+set(failed 0)
+
+foreach(program ${programs})
+
+    get_filename_component(name ${program} NAME_WE)
+
+    foreach(bits 8 32)
+
+        set(base ${WORK_DIR}/${name}-${bits})
+
+        execute_process(COMMAND ${BF} ${program} -c ${bits} --emit-c ${base}.c RESULT_VARIABLE result)
+
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "${name}, ${bits} bit cells: bf --emit-c failed")
+        endif()
+
+        execute_process(COMMAND ${CC} -O2 -o ${base} ${base}.c RESULT_VARIABLE result)
+
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "${name}, ${bits} bit cells: the emitted C does not compile")
+        endif()
+
+        execute_process(COMMAND ${BF} ${program} -c ${bits} INPUT_FILE ${input} OUTPUT_FILE ${base}.expected)
+        execute_process(COMMAND ${base} INPUT_FILE ${input} OUTPUT_FILE ${base}.out)
+        file(SHA256 ${base}.expected expected)
+        file(SHA256 ${base}.out actual)
+
+        if(expected STREQUAL actual)
+            message(STATUS "${name}, ${bits} bit cells: same output")
+        else()
+            message(SEND_ERROR "${name}, ${bits} bit cells: the emitted C prints something other than bf does")
+            set(failed 1)
+        endif()
+
+    endforeach()
+
+endforeach()
+
+if(failed)
+    message(FATAL_ERROR "The emitted C differs from bf")
+endif()
@@ -0,0 +1,348 @@
+Towers of Hanoi with 16 disks
+Prints every move of the iterative solution that steps a binary counter
+and moves the disk of the bit that changed from 0 to 1 in its fixed direction
+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++[-<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++>]<[->[-]+>[-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]>[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++
++++++++[-<++++++++>]<+++++.>++++++[-<+++++>]<++++.+++++++.>++++[-<---->]
+<-.>++++++++[-<-------->]<-----.>++++++++[-<++++++++>]<++++.+++++.++++++
+++++.--------.>+++++++++[-<-------->]<---.>++++[-<++++>]<+.+++++.>+++++[
+-<---->]<--.>++++++++[-<++++++++>]<++++++.++++++++++++.---.--.>+++++++++
+[-<-------->]<-----.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++.-----------------------
+------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>-]++++++[->+++++<]>++.<+++++++++[->+++++++++<]>+++.-----.<+++++++
+++[->--------<]>-------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++.------------------
+----------------------------------------------->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>++++++++++.[-]<<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[-
+>++++++++<]>+++++.<++++++[->+++++<]>++++.+++++++.<++++[->----<]>-.<+++++
++++[->--------<]>-----.<++++++++[->++++++++<]>++++.+++++.++++++++++.----
+----.<+++++++++[->--------<]>---.<++++[->++++<]>+.++++.<+++++[->----<]>-
+.<++++++++[->++++++++<]>++++++.++++++++++++.---.--.<+++++++++[->--------
+<]>-----.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++.--------------------------------
+---------------------------------+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>---<[-
+]+>>[-]<[->+>+<<]>>[-<<+>>]<[<<->>[-]]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]>++++++[-<+++++>]<++.>++++++
++++[-<+++++++++>]<+++.-----.>+++++++++[-<-------->]<-------.[-]<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++.-----------------------------------------------------
+------------>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<<-]<<->[-]
+]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++++.<++++++[->++++
++<]>++++.+++++++.<++++[->----<]>-.<++++++++[->--------<]>-----.<++++++++
+[->++++++++<]>++++.+++++.++++++++++.--------.<+++++++++[->--------<]>---
+.<++++[->++++<]>+.+++.<+++++[->----<]>.<++++++++[->++++++++<]>++++++.+++
++++++++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++.----------------------------------------------------------------->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]++++++[-<+++++>]<++.>+++++
+++++[-<+++++++++>]<+++.-----.>+++++++++[-<-------->]<-------.[-]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++.------------------------------------------------------
+----------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<-]<<->[-]]<[<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++++.<++++++[->+++++<]>++
+++.+++++++.<++++[->----<]>-.<++++++++[->--------<]>-----.<++++++++[->+++
++++++<]>++++.+++++.++++++++++.--------.<+++++++++[->--------<]>---.<++++
+[->++++<]>+.++.<++++[->----<]>---.<++++++++[->++++++++<]>++++++.++++++++
+++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-
+----------------------------------------------------------------+>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]>---<[-]+>>[-]<[->+>+<<]>>[-<<+>>]<[<<->>[-]]<<[<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]>++++++[-<+++++
+>]<++.>+++++++++[-<+++++++++>]<+++.-----.>+++++++++[-<-------->]<-------
+.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++.------------------------------------------
+----------------------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<<
+-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++++.<++++++[-
+>+++++<]>++++.+++++++.<++++[->----<]>-.<++++++++[->--------<]>-----.<+++
++++++[->++++++++<]>++++.+++++.++++++++++.--------.<+++++++++[->--------<
+]>---.<++++[->++++<]>+.+.<++++[->----<]>--.<++++++++[->++++++++<]>++++++
+.++++++++++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++.-----------------------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>-]++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+
+++.-----.>+++++++++[-<-------->]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.----
+------------------------------------------------------------->>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++
+++++[->++++++++<]>+++++.<++++++[->+++++<]>++++.+++++++.<++++[->----<]>-.
+<++++++++[->--------<]>-----.<++++++++[->++++++++<]>++++.+++++.+++++++++
++.--------.<+++++++++[->--------<]>---.<++++[->++++<]>+..<++++[->----<]>
+-.<++++++++[->++++++++<]>++++++.++++++++++++.---.--.<+++++++++[->-------
+-<]>-----.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++.-----------------------------------
+------------------------------+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>---<[-]+>>[-]<[->+>+<<]>>[-<<+>>]<[<<
+->>[-]]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-
+]>[-]>++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.-----.>+++++++++[
+-<-------->]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++.------------------------
+----------------------------------------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
++++++++++.[-]<<<-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++
+++.<++++++[->+++++<]>++++.+++++++.<++++[->----<]>-.<++++++++[->--------<
+]>-----.<++++++++[->++++++++<]>++++.+++++.++++++++++.--------.<+++++++++
+[->--------<]>---.<++++[->++++<]>+.-.----------------.<++++++++[->++++++
+++<]>++++++.++++++++++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++.--------------------------------------------------------
+--------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>-]++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.-----.>+++
+++++++[-<-------->]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++.-------------------
+---------------------------------------------->>>>>>>>>>>>>>>>>>>>>>>>>>
+>>++++++++++.[-]<<-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++
+++.<++++++[->+++++<]>++++.+++++++.<++++[->----<]>-.<++++++++[->--------<
+]>-----.<++++++++[->++++++++<]>++++.+++++.++++++++++.--------.<+++++++++
+[->--------<]>---.<+++++[->+++++<]>.<+++++[->-----<]>.<++++++++[->++++++
+++<]>++++++.++++++++++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++.---------------------------------------------------------
+--------+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>-
+--<[-]+>>[-]<[->+>+<<]>>[-<<+>>]<[<<->>[-]]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]>++++++[-<+++++>]<++.>+++++++++[-<+
+++++++++>]<+++.-----.>+++++++++[-<-------->]<-------.[-]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++.----------------------------------------------------------------->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<<-]<<->[-]]<[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++
++++++++[->++++++++<]>+++++.<++++++[->+++++<]>++++.+++++++.<++++[->----<]
+>-.<++++++++[->--------<]>-----.<++++++++[->++++++++<]>++++.+++++.++++++
+++++.--------.<+++++++++[->--------<]>---.<++++++[->++++<]>.<++++++[->--
+--<]>.<++++++++[->++++++++<]>++++++.++++++++++++.---.--.<+++++++++[->---
+-----<]>-----.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++.----------------------------------
+------------------------------->>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>
+>>>>>>>>>>>>>>>>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++>>>>>>>>>>>>>>>>
+>>>>>>>>>>>-]++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.-----.>+++
+++++++[-<-------->]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++.---------------------
+-------------------------------------------->>>>>>>>>>>>>>>>>>>>>>>>>>++
+++++++++.[-]<<-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++++.<++++
+++[->+++++<]>++++.+++++++.<++++[->----<]>-.<++++++++[->--------<]>-----.
+<++++++++[->++++++++<]>++++.+++++.++++++++++.--------.<+++++++++[->-----
+---<]>---.<+++++[->++++<]>+++.<+++++[->----<]>---.<++++++++[->++++++++<]
+>++++++.++++++++++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++.---------------------------------------------------------------
+--+>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]>---<[-]+>>[-]<[->+>+<
+<]>>[-<<+>>]<[<<->>[-]]<<[<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>
+>>>>>>>-]>[-]>++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.-----.>++
++++++++[-<-------->]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++.--------------------
+--------------------------------------------->>>>>>>>>>>>>>>>>>>>>>>>>>+
++++++++++.[-]<<<-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++++.<++++
+++[->+++++<]>++++.+++++++.<++++[->----<]>-.<++++++++[->--------<]>-----.
+<++++++++[->++++++++<]>++++.+++++.++++++++++.--------.<+++++++++[->-----
+---<]>---.<+++++[->++++<]>++.<+++++[->----<]>--.<++++++++[->++++++++<]>+
++++++.++++++++++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<<<<<<<<<
+<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++.----------------------------------------------------------------->
+>>>>>>>>>>>>>>>>>>>>>>>>[-]+<[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[<<<<<<<<<<<<
+<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]++>>>>>>>>>>>>>>>>>>>>>>>>>-]++++++[-<+++++>]<++.>+++++++++[-<++++++++
++>]<+++.-----.>+++++++++[-<-------->]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<<
+<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-----
+------------------------------------------------------------>>>>>>>>>>>>
+>>>>>>>>>>>>++++++++++.[-]<<-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+
+++++.<++++++[->+++++<]>++++.+++++++.<++++[->----<]>-.<++++++++[->-------
+-<]>-----.<++++++++[->++++++++<]>++++.+++++.++++++++++.--------.<+++++++
+++[->--------<]>---.<+++++[->++++<]>+.<+++++[->----<]>-.<++++++++[->++++
+++++<]>++++++.++++++++++++.---.--.<+++++++++[->--------<]>-----.[-]<<<<<
+<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++.-----------------------------------------------------------
+------+>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]>---<[-]+>>[-]<[->+>+<<]>>[-<<+>
+>]<[<<->>[-]]<<[<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>-]>[-]>
+++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.-----.>+++++++++[-<----
+---->]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++.------------------------------------
+----------------------------->>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<<-]
+<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++++.<++++++[->+++++<]>++++.++++
++++.<++++[->----<]>-.<++++++++[->--------<]>-----.<++++++++[->++++++++<]
+>++++.+++++.++++++++++.--------.<+++++++++[->--------<]>---.<+++++[->+++
++<]>.<+++++[->----<]>.<++++++++[->++++++++<]>++++++.++++++++++++.---.--.
+<+++++++++[->--------<]>-----.[-]<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++.----------------------
+------------------------------------------->>>>>>>>>>>>>>>>>>>>>>>[-]+<[
+-]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>]<<<[<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>-<[-]]>[
+<<<<<<<<<<<<<<<<<<<<<<<[-]++>>>>>>>>>>>>>>>>>>>>>>>-]++++++[-<+++++>]<++
+.>+++++++++[-<+++++++++>]<+++.-----.>+++++++++[-<-------->]<-------.[-]<
+<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++.---------------------------------------------------------
+-------->>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<-]<<->[-]]<[<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[
+->++++++++<]>+++++.<++++++[->+++++<]>++++.+++++++.<++++[->----<]>-.<++++
+++++[->--------<]>-----.<++++++++[->++++++++<]>++++.+++++.++++++++++.---
+-----.<+++++++++[->--------<]>---.<++++[->++++<]>+++.<++++[->----<]>---.
+<++++++++[->++++++++<]>++++++.++++++++++++.---.--.<+++++++++[->--------<
+]>-----.[-]<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++.---------------------------------------------
+--------------------+>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>---<[-]+>>[-]<[->+>+<<]>>[-<<+>
+>]<[<<->>[-]]<<[<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>-]>[-]>++++
+++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.-----.>+++++++++[-<--------
+>]<-------.[-]<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++.------------------------------------------
+----------------------->>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<<-]<<->[-]]
+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+++++++++[->++++++++<]>+++++.<++++++[->+++++<]>++++.+++++++.<++++[->
+----<]>-.<++++++++[->--------<]>-----.<++++++++[->++++++++<]>++++.+++++.
+++++++++++.--------.<+++++++++[->--------<]>---.<++++[->++++<]>++.<++++[
+->----<]>--.<++++++++[->++++++++<]>++++++.++++++++++++.---.--.<+++++++++
+[->--------<]>-----.[-]<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++.----------------------------------
+------------------------------->>>>>>>>>>>>>>>>>>>>>[-]+<[-]<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<[<<<<<<<<
+<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>-<[-]]>[<<<<<<<<<<<<<<<<<<<<<[-]++>>>>
+>>>>>>>>>>>>>>>>>-]++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.----
+-.>+++++++++[-<-------->]<-------.[-]<<<<<<<<<<<<<<<<<<<<+++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++.---------------------
+-------------------------------------------->>>>>>>>>>>>>>>>>>>>++++++++
+++.[-]<<-]<<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+++++++++[->++++++++<]>+++++.<++++++[->+++++<]>++++.
++++++++.<++++[->----<]>-.<++++++++[->--------<]>-----.<++++++++[->++++++
+++<]>++++.+++++.++++++++++.--------.<+++++++++[->--------<]>---.<++++[->
+++++<]>+.<++++[->----<]>-.<++++++++[->++++++++<]>++++++.++++++++++++.---
+.--.<+++++++++[->--------<]>-----.[-]<<<<<<<<<<<<<<<<<<<<+++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++.---------------------
+--------------------------------------------+>>>>>>>>>>>>>>>>>>>>[-]<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]>---<[-]+>>[-]<[->+>+<
+<]>>[-<<+>>]<[<<->>[-]]<<[<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>-]>[-
+]>++++++[-<+++++>]<++.>+++++++++[-<+++++++++>]<+++.-----.>+++++++++[-<--
+------>]<-------.[-]<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++.--------------------------------------
+--------------------------->>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<<-]<]
@@ -0,0 +1,129 @@
+Input stress test
+Reads until the end of the input and prints the number of lines and bytes
+like wc with l and c options  The input must not contain zero bytes
+
+>[-]+[<[-],>>>>[-]+>[-]<<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[<<<
++>>>>[-]<<<<<<[->>>>>>+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<---------->[-
+]+>[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<->[-]]<[<<<<+>>>>-]<[-]<<->[-]]<[<<<[
+-]>>>-]<<<]<[-]>>>>>[-]<<[->>+<+<]>[-<+>][-]++++++++++>>>>>>>>>>>>>[-]<<
+<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>[-]<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>[->[->+
+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>[-<<<<<<<<<+>>>
+>>>>>>]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]+<[-]>>>>>>>>>>>[
+-<<<<<<<<<<<+>>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<[>-<[-]]>[>>[
+-]<<<<+>>-]>>>>>>>>>>[-]<<<<<<<<<<<<<[-]>[-<+>]>>>>>>>>>>>[-]<<<<<<<<<<<
+<[->>>>>>>>>>>>+<<<<<<<<<<+<<]>>[-<<+>>]>>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>+<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>[->[->+>>]>[<<+>>[-<
++>]>+>>]<<<<<]<<<<<<<<<<<[-]>>>>>[-]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<[-]+>[-]>>>>>>>>>>[-<<<<<<<<<<+>+>
+>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<[<->[-]]<[>>>>[-]<<<<<+>-]>>>>>
+>>>>>>[-]<<<<<<<<<<<<<[-]>[-<+>]>>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>
++<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+
+<<<<<<<<<<+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<
+<<]<<<<<<<<<<<[-]>>>>>>[-]>>>>>>>[-<<<<<<<+>>>>>>>]>[-<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>]<<<<<<<<<<<<[-]+<[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>+>>>>>>>>>]<<
+<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<[>-<[-]]>[>>>>[-]<<<<<<+>>-]>>>>>>>>>>[-]
+<<<<<<<<<<<<<[-]>[-<+>]>>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<
+<<+<<]>>[-<<+>>]>>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<
++<<<]>>>[-<<<+>>>]>>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<
+<[-]>>>>>>>[-]>>>>>>[-<<<<<<+>>>>>>]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<[-]+>[-]>>>>>>>>>>[-<<<<<<<<<<+>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>
+>+<<<<<<<<<]<[<->[-]]<[>>>>>>[-]<<<<<<<+>-]>>>>>>>>>>>[-]<<<<<<<<<<<<<[-
+]>[-<+>]>>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<+<<<]>>>[-<<<+
+>>>]>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<+<<<<]>>>>[-<<
+<<+>>>>]>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<[-]>>>>>>>
+>[-]>>>>>[-<<<<<+>>>>>]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]+
+<[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<
+]<<[>-<[-]]>[>>>>>>[-]<<<<<<<<+>>-]>>>>>>>>>>[-]<<<<<<<<<<<<<[-]>[-<+>]>
+>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<+<<]>>[-<<+>>]>>>>>>>>
+>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>
+>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<[-]>>>>>>>>>[-]>>>>[-<<
+<<+>>>>]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<[-]+>[-]>>>>>>>>>>
+[-<<<<<<<<<<+>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<[<->[-]]<[>>>>>
+>>>[-]<<<<<<<<<+>-]>>>>>>>>>>>[-]<<<<<<<<<<<<<[-]>[-<+>]>>>>>>>>>>>[-]<<
+<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>[-]<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>[->[->+
+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<[-]>>>>>>>>>>[-]>>>[-<<<+>>>]>[-<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]+<[-]>>>>>>>>>>>[-<<<<<<<<<<<
++>>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<[>-<[-]]>[>>>>>>>>[-]<<<<
+<<<<<<+>>-]>>>>>>>>>>[-]<<<<<<<<<<<<<[-]>[-<+>]<<[-]>[-]>>[-]>>>>>>>>>[-
+<<<<<<<<<+>+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]<[<[-]+>[-]][-]<[->+>+<
+<]>>[-<<+>>]<[>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.
+------------------------------------------------<<<<<<<<<[-]][-]>>>>>>>>
+[-<<<<<<<<+>+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]<[<[-]+>[-]][-]<[->+>+<<]>
+>[-<<+>>]<[>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.----
+--------------------------------------------<<<<<<<<[-]][-]>>>>>>>[-<<<<
+<<<+>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[<[-]+>[-]][-]<[->+>+<<]>>[-<<+>>]<[
+>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.----------------
+--------------------------------<<<<<<<[-]][-]>>>>>>[-<<<<<<+>+>>>>>]<<<
+<<[->>>>>+<<<<<]<[<[-]+>[-]][-]<[->+>+<<]>>[-<<+>>]<[>>>>>>+++++++++++++
++++++++++++++++++++++++++++++++++++.------------------------------------
+------------<<<<<<[-]][-]>>>>>[-<<<<<+>+>>>>]<<<<[->>>>+<<<<]<[<[-]+>[-]
+][-]<[->+>+<<]>>[-<<+>>]<[>>>>>+++++++++++++++++++++++++++++++++++++++++
++++++++.------------------------------------------------<<<<<[-]][-]>>>>
+[-<<<<+>+>>>]<<<[->>>+<<<]<[<[-]+>[-]][-]<[->+>+<<]>>[-<<+>>]<[>>>>+++++
++++++++++++++++++++++++++++++++++++++++++++.----------------------------
+--------------------<<<<[-]]>>>+++++++++++++++++++++++++++++++++++++++++
++++++++.------------------------------------------------[-]>[-]>[-]>[-]>
+[-]>[-]>[-]<<<<<<<<<<[-]<<++++++[->>+++++<<]>>++.[-][-]<<<<[->>>>+<<+<<]
+>>[-<<+>>][-]++++++++++>>>>>>>>>>>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<
+<<+<]>[-<+>]>>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<+<<<
+]>>>[-<<<+>>>]>>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<<[-
+]>>>>>[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<[-]+>[-]>>>>>>>>>>[-<<<<<<<<<<+>+>>>>>>>>>]<<<<<<<<<[->>
+>>>>>>>+<<<<<<<<<]<[<->[-]]<[>>>[-]<<<<<+>>-]>>>>>>>>>>>[-]<<<<<<<<<<<<[
+-]<[->+<]>>>>>>>>>>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<+<<]>>[-<<+>>]
+>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<+<<<<]>>>>[-<<<<+>
+>>>]>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<<[-]>>>>>>[-]>
+>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<[-]+<[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<
+<<<<<<]<<[>-<[-]]>[>>>[-]<<<<<<+>>>-]>>>>>>>>>>[-]<<<<<<<<<<<<[-]<[->+<]
+>>>>>>>>>>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>[
+-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>
+[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<<[-]>>>>>>>[-]>>>>>>>[-<<<<
+<<<+>>>>>>>]>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<[-]+>[-]>>>>
+>>>>>>[-<<<<<<<<<<+>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<[<->[-]]<
+[>>>>>[-]<<<<<<<+>>-]>>>>>>>>>>>[-]<<<<<<<<<<<<[-]<[->+<]>>>>>>>>>>>>[-]
+<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<+<<]>>[-<<+>>]>>>>>>>>>>[-]<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>+<<<<<<<<<<+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>[->[->+>>]>
+[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<<[-]>>>>>>>>[-]>>>>>>[-<<<<<<+>>>>>>]>
+[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]+<[-]>>>>>>>>>>>[-<<<<<
+<<<<<<+>>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<[>-<[-]]>[>>>>>[-]<
+<<<<<<<+>>>-]>>>>>>>>>>[-]<<<<<<<<<<<<[-]<[->+<]>>>>>>>>>>>>[-]<<<<<<<<<
+<<[->>>>>>>>>>>+<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>+<<<<<<<<<<<+<<<]>>>[-<<<+>>>]>>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>
++>>]<<<<<]<<<<<<<<<<<<[-]>>>>>>>>>[-]>>>>>[-<<<<<+>>>>>]>[-<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<[-]+>[-]>>>>>>>>>>[-<<<<<<<<<<+>+>>>>>>>
+>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<[<->[-]]<[>>>>>>>[-]<<<<<<<<<+>>-]>>>
+>>>>>>>>[-]<<<<<<<<<<<<[-]<[->+<]>>>>>>>>>>>>[-]<<<<<<<<<<<[->>>>>>>>>>>
++<<<<<<<<<+<<]>>[-<<+>>]>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<
+<<<<<<+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<
+<<<<<<<<<<<[-]>>>>>>>>>>[-]>>>>[-<<<<+>>>>]>[-<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>]<<<<<<<<<<<<[-]+<[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>+>>>>>>>>>]<<<<<<<<
+<[->>>>>>>>>+<<<<<<<<<]<<[>-<[-]]>[>>>>>>>[-]<<<<<<<<<<+>>>-]>>>>>>>>>>[
+-]<<<<<<<<<<<<[-]<[->+<]>>>>>>>>>>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<
+<<+<]>[-<+>]>>>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<+<<<
+]>>>[-<<<+>>>]>>>>>>>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<<[-
+]>>>>>>>>>>>[-]>>>[-<<<+>>>]>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<
+<<<<[-]+>[-]>>>>>>>>>>[-<<<<<<<<<<+>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<
+<<<<<]<[<->[-]]<[>>>>>>>>>[-]<<<<<<<<<<<+>>-]>>>>>>>>>>>[-]<<<<<<<<<<<<[
+-]<[->+<]<[-]>>[-]>>[-]>>>>>>>>[-<<<<<<<<+<+>>>>>>>>>]<<<<<<<<<[->>>>>>>
+>>+<<<<<<<<<]>[<<<[-]+>>>[-]][-]<<<[->>>+<+<<]>>[-<<+>>]>[>>>>>>>>++++++
+++++++++++++++++++++++++++++++++++++++++++.-----------------------------
+-------------------<<<<<<<<[-]][-]>>>>>>>[-<<<<<<<+<+>>>>>>>>]<<<<<<<<[-
+>>>>>>>>+<<<<<<<<]>[<<<[-]+>>>[-]][-]<<<[->>>+<+<<]>>[-<<+>>]>[>>>>>>>++
+++++++++++++++++++++++++++++++++++++++++++++++.-------------------------
+-----------------------<<<<<<<[-]][-]>>>>>>[-<<<<<<+<+>>>>>>>]<<<<<<<[->
+>>>>>>+<<<<<<<]>[<<<[-]+>>>[-]][-]<<<[->>>+<+<<]>>[-<<+>>]>[>>>>>>++++++
+++++++++++++++++++++++++++++++++++++++++++.-----------------------------
+-------------------<<<<<<[-]][-]>>>>>[-<<<<<+<+>>>>>>]<<<<<<[->>>>>>+<<<
+<<<]>[<<<[-]+>>>[-]][-]<<<[->>>+<+<<]>>[-<<+>>]>[>>>>>++++++++++++++++++
+++++++++++++++++++++++++++++++.-----------------------------------------
+-------<<<<<[-]][-]>>>>[-<<<<+<+>>>>>]<<<<<[->>>>>+<<<<<]>[<<<[-]+>>>[-]
+][-]<<<[->>>+<+<<]>>[-<<+>>]>[>>>>++++++++++++++++++++++++++++++++++++++
+++++++++++.------------------------------------------------<<<<[-]][-]>>
+>[-<<<+<+>>>>]<<<<[->>>>+<<<<]>[<<<[-]+>>>[-]][-]<<<[->>>+<+<<]>>[-<<+>>
+]>[>>>++++++++++++++++++++++++++++++++++++++++++++++++.-----------------
+-------------------------------<<<[-]]>>++++++++++++++++++++++++++++++++
+++++++++++++++++.------------------------------------------------[-]>[-]
+>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<[-]++++++++++.[-]
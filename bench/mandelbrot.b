@@ -0,0 +1,265 @@
+Mandelbrot set renderer
+78 by 24 characters in fixed point arithmetic with scale 32 and 24 iterations
+Values are kept as sign and magnitude  Needs at least 16 bit cells
+
+>>>>>[-]+>[-]>>>>>>>>>>>>>>>>>>>>>++++++[-<<<<<<<<<<<<<<<<<<<<<++++++>>>
+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]>[-]+++<<<[-]>[-]+<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>++++++[-<<<<<<<<<<<<<<<<<<<<<<<<<<<++++>>>>>>>>>
+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>[-]+>[-]>>>>>>>>>
+>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++++[-<<<<<<<<<<<
+<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<++++++[->>>>>>>>[-]>[-]>[-]>[-]<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>+
++++++[-<<<<<<<<<<<<<<<<<<<<<<<<++++>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]+>>[-]<<[>>>>>>>>>>>>>>>[-]>[-]>>>>>>>>>[-]>[-]<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>]<][-]>>++++++[-<<+++++>>]<<++>>>[-]<<<<[->>>>+<+<<
+<]>>>[-<<<+>>>]>>[-]<<<<[->>>>+<<+<<]>>[-<<+>>]>[->[->+>>]>[<<+>>[-<+>]>
++>>]<<<<<]<<<<<<<<<<<<<[-]>>>>>>>>>>>[-]>>>>[-<<<<+>>>>]>[-<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>]<<<<[-]+>>>>>>>[-]<<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<
+<<<+>>>>>>]<[<<<<<<<->>>>>>>[-]]<<<<<<<[<[-]<<<<<<<<<<<+>>>>>>>>>>>>-]>>
+[-]<<<<[-]>[-]<<[-]<<<<<<<<<<[-]<<<<<<<<[->>>>>>>>+>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>][-]<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<[>>+<<<<<<<<<<<<[
+->>>>>>>>>>>>-<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<[-]
+]<<<<<<<<[-]>[-]>>>>>>>[-]>>[-]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<+<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>[-<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>][-]>>>>>>>>++++++[-<<<<<<<<+++++>>>>>>
+>>]<<<<<<<<++>>[-]<<<<[->>>>+>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>
+>>>>>>>>]<<<<<[-]<<<[->>>+>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<
+<<<[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<<<[-]>>>>>>>>[-]>>>>>[-<<<
+<<+>>>>>]>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>>>[-]+<<<<<<<[-]>>[-<<+>>>>>>
+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<[>>>>>>>-<<<<<<<[-]]>>>>>>>[<<<<
+<<<<<[-]<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<[-]<<<[-]<[-]<[-]<<<<<<<<[-]<<<
+<<<<<[->>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>+<<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<[>+<<<<<
+<<<<[->>>>>>>>>-<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-]]<<[-]<<<<<
+<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<[->>>>>+>
+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>][-]>>+++++++++++[-<<+++++++++++>>]<<+
++++++++>>>>[-]<<<<<<[->>>>>>+<<+<<<<]>>>>[-<<<<+>>>>]>>>[-]<<<<<[->>>>>+
+<<<+<<]>>[-<<+>>]>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<[-]>>[-]>>>>>[
+-<<<<<+>>>>>]>[-<<<<<<<<+>>>>>>>>]<<<<<[-]+>[-]>>[-<<+>>>>>>>+<<<<<]>>>>
+>[-<<<<<+>>>>>]<<<<<<<[<->[-]]<[<[-]<<+>>>-]>>>[-]<<<<<[-]>[-]<<<[-]>>>[
+-]+<[-]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<<[<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>>>>>>>>>>>-<[-]]>[<<<<<<<[-]>[-]>>>>>>>>[-]<[-]<<<<<<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>]<<<<<<<<[-<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>>>>>>+<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<][-]>[-<++>]<[->+<][-]>>>>>>>>>++++++[-<
+<<<<<<<<+++++>>>>>>>>>]<<<<<<<<<++>>[-]<[->+>>>>>>>+<<<<<<<<]>>>>>>>>[-<
+<<<<<<<+>>>>>>>>]<<<<<<[-]<<<[->>>+>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<
++>>>>>>>>>]<<<<<<<[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<<<<<<[-]>>>>>>>>
+>>>>>>>[-]<<<<[->>>>+<<<<]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>[-]+>[-]<<<<<
+<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<->[-]]<[<[-]<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<[-]<<<[-]>>>>>>>>[-]<<<<<<<[-]<<<<<<<<
+<[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<<<<<<<[>>>>>>>+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<[-]][-]<<<<<<<
+<<[->>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>>>>>>>>[<<<<<<<<
++>[-<->]<[->+<]>>>>>>>>[-]]+<<<<<<<[->>>>>>>-<<<<<<<]>>>>>>>[-<<<<<<<+>>
+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<
+<<<<[-]>[-<+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<
+<<[<<<<<<<[-<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[-<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<-<<<<<<<<[-]]>>>>>>>>[>>[-]<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[->>>[-]+>[-]<<<[->>>
++>+<<<<]>>>>[-<<<<+>>>>]<[<<<->>->[-]]<[<+>-]<<<]>>>>[-]<<<[->>>+<+<<]>>
+[-<<+>>]>[<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>]>[-]][-]<<[->>+<+<]>[-<+>]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]]<<<[-<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<-]<<<<<<<[-]+<<<<<<<<<<<[->>>>>>
+>>>>>-<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>][-]<<<<<<<<<<<<<[
+->>>>>>>>>>>>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>][-
+]<<<<<<<<<<[->>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<[>>>>>>>>+<<<<<<<[->>>>>>>
+-<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]]+>[-<->]<[->+<]<<<<<<<<[-]
+>[-]>>>>>>>[-]+>>>>>>>>[-]<<<<<<<[->>>>>>>+>>>+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<<[<<<<<<<<<<<<<<<<<<<[->>>>+>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[->>+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>]<<<<<<<<<<<->>>>>>>>[-]]<<<<<<<<[>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<[-]<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<<<[->>>>[-
+]+<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<->>-<[-]]>[<<<+>>>-]<<<<]>>>[-]<[->+>
++<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<[->>>>+>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<[-]][-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<<<<<<
+<<<<<<<<<<<<<<<<[->>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<[-]
+]<[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>>]<<<<<<<<<<-]>[-][-]<<<<<<<<<[->>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>]>>>>>>>>[<<<<<<<<+>[-<->]<[->+<]>>>>>>>>[-]]+<<<<<<<[->>>>>>>-<<<<
+<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<[-]>[-<+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<
+<<<<<<<<+>>>>>>>>>]<<<<<<<<<<[<<<<<<<[-<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>+>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<[-<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<-<<<<<<<<[-
+]]>>>>>>>>[>>[-]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<<[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[->>>[-]+>
+[-]<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[<<<->>->[-]]<[<+>-]<<<]>>>>[-]<<<[-
+>>>+<+<<]>>[-<<+>>]>[<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]>[-]][-]<<[->>+<+<]>[-<+>]>[<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]]<<<[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<-]<<<<<<<[-]<<<<<<<<<
+<<<<<<<<<<<<<<<<<+<->>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<[-]<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<[>-<[-]]>[<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<-]<<[-]<<<<<<<<<[-]
+>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[
+-]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>]<[>>>>>>>>>[-]++<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<[-]>>>>>[-<<<<<+>>>>>>+<]>[-<
++>]<<<<<<<[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<[-]>>>>>>>>>>>[-]<<<<<<<[-
+>>>>>>>+<<<<<<<]>[-<<<<<+>>>>>]>>>>[-]+>[-]<<<<<<<[->>>>>>>+>>>+<<<<<<<<
+<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<[<->[-]]<[>>[-]<<<<<<<<<<<+>>>>>
+>>>>-]<<<<<<[-]>>>>>[-]>>>[-][-]+<<<[-]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]
+>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<[>>>-<<<[-]]>>>[<[-]+<[-]<<<<<<<<[->
+>>>>>>>+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<[>
+-<[-]]>[>>++++++[->+++++<]>++.[-]<<<<<<<<<<<<[-]+>>>>>>>>>-]>-]<<<[-]<<<
+<<<<<[->>>>>>>>+>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<
+[<<<<<<<<->>>>>>>>[-]][-]+>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<+<<<<<<<<<]>>
+>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>[<<<->>>[-]]<<<[>[-]+>[-]<<<<<<<<<[->>>>>
+>>>>+>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<[<->[-]
+]<[>>>+++++++[->++++++<]>++++.[-]<<<<<<<<<<<<[-]+>>>>>>>>-]<-]>>>[-]<<<<
+<<<<<<<[->>>>>>>>>>>+<<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>[<<<<<<
+<<<<<->>>>>>>>>>>[-]][-]+<<<[-]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>
+>>[-<<<<<<<<<<+>>>>>>>>>>]<<[>>>-<<<[-]]>>>[<[-]+<[-]<<<<<<<<[->>>>>>>>+
+>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<[>-<[-]]>[
+>>+++++++[->++++++<]>++.[-]<<<<<<<<<<<<[-]+>>>>>>>>>-]>-]<<<[-]<<<<<<<<[
+->>>>>>>>+>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<[<<<<<
+<<<->>>>>>>>[-]][-]+>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<+<<<<<<<<<]>>>>>>>>
+>[-<<<<<<<<<+>>>>>>>>>]>>[<<<->>>[-]]<<<[>[-]+>[-]<<<<<<<<<[->>>>>>>>>+>
+>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<[<->[-]]<[>>>
+++++++++[->+++++++<]>++.[-]<<<<<<<<<<<<[-]+>>>>>>>>-]<-]>>>[-]<<<<<<<<<<
+<[->>>>>>>>>>>+<<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>[<<<<<<<<<<<-
+>>>>>>>>>>>[-]][-]+<<<[-]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<[>>>-<<<[-]]>>>[<[-]+<[-]<<<<<<<<[->>>>>>>>+>>>>+<
+<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<[>-<[-]]>[>>++++
+++++[->+++++++<]>+++.[-]<<<<<<<<<<<<[-]+>>>>>>>>>-]>-]<<<[-]<<<<<<<<[->>
+>>>>>>+>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<[<<<<<<<<
+->>>>>>>>[-]][-]+>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]>>[<<<->>>[-]]<<<[>[-]+>[-]<<<<<<<<<[->>>>>>>>>+>>>+
+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<[<->[-]]<[>>>+++
++++++[->+++++++<]>+++++.[-]<<<<<<<<<<<<[-]+>>>>>>>>-]<-]>>>[-]<<<<<<<<<<
+<[->>>>>>>>>>>+<<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>[<<<<<<<<<<<-
+>>>>>>>>>>>[-]][-]+<<<[-]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<[>>>-<<<[-]]>>>[<[-]+<[-]<<<<<<<<[->>>>>>>>+>>>>+<
+<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<[>-<[-]]>[>>++++
++++[->++++++<]>+.[-]<<<<<<<<<<<<[-]+>>>>>>>>>-]>-]<<<[-]<<<<<<<<[->>>>>>
+>>+>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<[<<<<<<<<->>>
+>>>>>[-]][-]+>>>[-]<<<<<<<<<<<[->>>>>>>>>>>+<<+<<<<<<<<<]>>>>>>>>>[-<<<<
+<<<<<+>>>>>>>>>]>>[<<<->>>[-]]<<<[>[-]+>[-]<<<<<<<<<[->>>>>>>>>+>>>+<<<<
+<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<[<->[-]]<[>>>+++++++
+[->++++++<]>.[-]<<<<<<<<<<<<[-]+>>>>>>>>-]<-]>>>[-]<<<<<<<<<<<[->>>>>>>>
+>>>+<<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>[<<<<<<<<<<<->>>>>>>>>>>
+[-]][-]+<<<[-]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>
+>>>>>>>>]<<[>>>-<<<[-]]>>>[<[-]+<[-]<<<<<<<<[->>>>>>>>+>>>>+<<<<<<<<<<<<
+]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<[>-<[-]]>[>>++++++[->++++++
+<]>+.[-]<<<<<<<<<<<<[-]+>>>>>>>>>-]>-]<<<[-]<<<<<<<<[->>>>>>>>+>>>+<<<<<
+<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<[<<<<<<<<->>>>>>>>[-]][-]
++>>>[-]<<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>
+[<<<->>>[-]]<<<[>>+++++++[-<+++++>]<.[-]<<<<<<<<[-]+>>>>>>>-]<<<<<<<<[-]
+>[-]<<<->[-]]<[>>++++++++[->++++++++<]>.[-]<<<-]>[-]<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>+>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>]<<<[>>>+<<[->>-<<]>>[-<<+>>]<<<[-]]+>[-<->]<[->+<]<<<<[-]>[-]>>>[
+-]+>>>[-]<<[->>+<+<]>[-<+>]>[<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>
+>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<[->>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<->>>[-]]<<<[>>[-]<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>>[-<<[-]+>[-]<<<<<<<<<<
+[->>>>>>>>>>+>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>
+>]<<<[<<<<<<<<<<->>>>>>>>>->[-]]<[<+>-]>>]<[-]<<<<<<<<<<[->>>>>>>>>>+<+<
+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]>[-]][-]<<[->>+<+<]>[-<+>]>[<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]]<
+<<<<<<<<<[-<<<<<+>>>>>]>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<-
+]>[-]<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-][-]<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>+<<<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>
+>>>>>>]>>>[<<<+>[-<->]<[->+<]>>>[-]]+<<[->>-<<]>>[-<<+>>]<<<<<<<[-]>[-]>
+>>>>>[-]+<<<[-]>[-<+>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]
+<<<<<<<<<<[<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<-<<<[-]]>>>[>>>>>>>[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]>[-<[-]+<[-]<[->
++>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[<->>-<[-]]>[<<<<<<<<<<+>>>>>>>>>>-]>
+]<<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]<[-]][-]<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>
+>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[-]]<[-<<<<<<<<<<<<<+>>>>>>>>>>>>
+>]<<<<<<<<[-<<<<<+>>>>>]>-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<]
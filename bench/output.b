@@ -0,0 +1,16 @@
+Output stress test
+Prints the same 44 character line 200000 times
+
+[-]>>++++++++++++++[-<<++++++++++++++>>]<<++++[->[-]>+++++++++++++++++++
++++++++++++++[-<+++++++++++++++++++++++++++++++>]<++++++++[->>+++++++++[
+-<+++++++++>]<+++.>+++++[-<++++>]<.---.>++++++++[-<-------->]<-----.>+++
+++++++[-<+++++++++>]<.++++.------------.------.++++++++.>+++++++++[-<---
+----->]<---.>++++++++[-<++++++++>]<++.++++++++++++++++.---.++++++++.----
+-----.>+++++++++[-<-------->]<------.>++++++++[-<++++++++>]<++++++.+++++
+++++.+++++++++.>+++++++++[-<--------->]<-------.>+++++++++[-<++++++++>]<
+++.+++++++++++.--------.+++.+++.>+++++++++[-<--------->]<--.>+++++++++[-
+<++++++++>]<+++++++.+++++++.>++++[-<---->]<-.+++++++++++++.>+++++++++[-<
+--------->]<-.>+++++++++[-<+++++++++>]<+++.------------.---.>++++++++[-<
+-------->]<-----.>+++++++++[-<++++++++>]<++++.-----------.>+++++[-<+++++
+>]<.-.>+++++++++[-<--------->]<--------.>++++++++[-<++++++++>]<++++.++++
++++++++.--------.>++++++++++[-<--------->]<---.[-]<]<]
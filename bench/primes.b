@@ -0,0 +1,95 @@
+Prime numbers below 1000
+Trial division by every candidate up to the square root with the usual
+divmod loop so the work grows with the size of the numbers
+
+[-]++>[-]>>>>>>>++++++++++++++++++++++++++++++++[-<<<<<<<+++++++++++++++
+++++++++++++++++>>>>>>>]<<<<<<<+++++++[->>>>[-]+<<<[-]++>>>>[-]+>>[-]<<<
+<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-]>>[-]+++
++[->[-]+>[-]<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[<->[-]]<[<<<[-]+>>>-]>[-]<
+<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>[-]]<<]<[-]>[-]<<[->>+<+<]>[-<+>]>[<<<[-
+]>>>[-]]<<[-]<[>>>>>>>[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<+<<<<<<<<<]>>>
+>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<+<<<
+<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<<<
+<<<<<<[-]>[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>[-<<<<<<<<<<<<<+>>>>>
+>>>>>>>>]<<<<<<<[-]+<[-]>>>>>>[-<<<<<<+>>>+>>>]<<<[->>>+<<<]<<<[>-<[-]]>
+[<<<<<[-]<+>>>>>>-]>>>>>[-]<<<<<<[-]+>[-]<<<<<[->>>>>+>>+<<<<<<<]>>>>>>>
+[-<<<<<<<+>>>>>>>]<<[<->[-]]<[<<<[-]>[-]>>-]<<<<<<+>>>>>>>[-]<<<<<<[->>>
+>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<[-]<<<<<<[->>>>>>+>>>+<<<
+<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<[->>>[-]+<[-]<[->+>>+<<<]>>>[-<
+<<+>>>]<<[<->>-<[-]]>[<<<<[-]+>>>>-]<<<]>>[-]<<<[->>>+>+<<<<]>>>>[-<<<<+
+>>>>]<[<<<<[-]>>>>[-]]<<<[-]>>[-]<<<<<<[-]>[-]>>]>>[-]<<<[->>>+>+<<<<]>>
+>>[-<<<<+>>>>]<[>[-]<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<
+<<<<+>>>>>>>>>>][-]++++++++++>>>[-]<<<<[->>>>+<+<<<]>>>[-<<<+>>>]>>[-]<<
+<<[->>>>+<<+<<]>>[-<<+>>]>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<[-]>>>>>>>
+>[-]<<<<[->>>>+<<<<]>[-<<<<<+>>>>>]<<<<[-]+>>>>>>>>>>>>>>[-]<<<<<<<<<<<<
+[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>
+>]<[<<<<<<<<<<<<<<->>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[>>>>>>>[-]<<<<<<<<+>
+-]>>[-]<<<<<[-]>>[-<<+>>]>>[-]<<<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]<
+<<<[->>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<[-]
+>>>>>>>>>[-]<<<<<[->>>>>+<<<<<]>[-<<<<<+>>>>>]>>>>>>>>>>[-]+<<<<<<<<<<<<
+<<[-]>>[-<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>-<<<<<<<<<<<<<<[-]]>>>>>>>>>>
+>>>>[<<<<<<[-]<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<[-]<<<<<[-]>>[-<<+>
+>]>>[-]<<<<[->>>>+<+<<<]>>>[-<<<+>>>]>>[-]<<<<[->>>>+<<+<<]>>[-<<+>>]>[-
+>[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<[-]>>>>>>>>>>[-]<<<<<<[->>>>>>+<<<<<<]
+>[-<<<<<+>>>>>]<<<<[-]+>>>>>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>+<<<
+<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<->
+>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[>>>>>>>>>[-]<<<<<<<<<<+>-]>>[-]<<<<<[-]>
+>[-<<+>>]>>[-]<<<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]<<<<[->>>>+>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>]<<<<<<<<<<<<<[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<[-]>>>>>>>>>>>[-]<<
+<<<<<[->>>>>>>+<<<<<<<]>[-<<<<<+>>>>>]>>>>>>>>>>[-]+<<<<<<<<<<<<<<[-]>>[
+-<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>-<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>[<<<
+<[-]<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<[-]<<<<<[-]>>[-<<+>>]>>[-]<
+<<<[->>>>+<+<<<]>>>[-<<<+>>>]>>[-]<<<<[->>>>+<<+<<]>>[-<<+>>]>[->[->+>>]
+>[<<+>>[-<+>]>+>>]<<<<<]<<[-]>>>>>>>>>>>>[-]<<<<<<<<[->>>>>>>>+<<<<<<<<]
+>[-<<<<<+>>>>>]<<<<[-]+>>>>>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>+<<<
+<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[<<<<<<<<<<<<<<->
+>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[>>>>>>>>>>>[-]<<<<<<<<<<<<+>-]>>[-]<<<<<
+[-]>>[-<<+>>]>>[-]<<<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<[-]<<<<[->>>>+>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<[-]>>>>>>>>>>>>
+>[-]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>[-<<<<<+>>>>>]>>>>>>>>>>[-]+<<<<<<<<
+<<<<<<[-]>>[-<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>-<<<<<<<<<<<<<<[-]]>>>>>>
+>>>>>>>>[<<[-]<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<[-]<<<<<[-]>>[-
+<<+>>]>>[-]<<<<[->>>>+<+<<<]>>>[-<<<+>>>]>>[-]<<<<[->>>>+<<+<<]>>[-<<+>>
+]>[->[->+>>]>[<<+>>[-<+>]>+>>]<<<<<]<<[-]>>>>>>>>>>>>>>[-]<<<<<<<<<<[->>
+>>>>>>>>+<<<<<<<<<<]>[-<<<<<+>>>>>]<<<<[-]+>>>>>>>>>>>>>>[-]<<<<<<<<<<<<
+[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>
+>]<[<<<<<<<<<<<<<<->>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[>>>>>>>>>>>>>[-]<<<<
+<<<<<<<<<<+>-]>>[-]<<<<<[-]>>[-<<+>>]<[-]<[-]>>>>>>>>>>>>>>>>>[-]<[->+<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>
+>>>>>>>>>>>>[<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>[-]][-]<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>[<+++++++++++++++++
++++++++++++++++++++++++++++++++.----------------------------------------
+-------->[-]][-]<<[->>+<<<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>[-]]
+[-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>>
+>>[<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------
+------------------------------>>[-]][-]<<<[->>>+<<<<<<<<<<<<<<+>>>>>>>>>
+>>]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<[-
+]+>>>>>>>>>>>>>>>[-]][-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+
+<]>[-<+>]>>>>>>>>>>>>>>[<<<+++++++++++++++++++++++++++++++++++++++++++++
++++.------------------------------------------------>>>[-]][-]<<<<[->>>>
++<<<<<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>>
+>>>[<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>[-]][-]<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>[<<<<+++++++++++++++++++++++
++++++++++++++++++++++++++.----------------------------------------------
+-->>>>[-]][-]<<<<<[->>>>>+<<<<<<<<<<<<<<+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+
+<<<<<<<<<]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>[-]][-]<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>[<<<<<+
++++++++++++++++++++++++++++++++++++++++++++++++.------------------------
+------------------------>>>>>[-]][-]<<<<<<[->>>>>>+<<<<<<<<<<<<<<+>>>>>>
+>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<[-]+>>>>>>>
+>>>>>>>>[-]][-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<+<]>[-<+>]
+>>>>>>>>>>>>>>[<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.--
+---------------------------------------------->>>>>>[-]]<<<<<<<+++++++++
++++++++++++++++++++++++++++++++++++++++.--------------------------------
+----------------[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<[-]++++++++++.[
+-]<<<[-]]<<<<<<<<+>]
@@ -0,0 +1,162 @@
+#include "AsyncWriter.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <sys/uio.h>
+#include <unistd.h>
+
+
+AsyncWriter::AsyncWriter(int fd,std::size_t capacity)
+    :mRing(new char[capacity]),mCapacity(capacity),mFd(fd),mHead(0),mTail(0),mFailed(false),mClosed(false),
+    mProducerWaiting(false),mWriterWaiting(false)
+{
+
+    mThread = std::thread(&AsyncWriter::run,this);
+
+}
+
+
+AsyncWriter::~AsyncWriter()
+{
+
+    {
+
+        std::lock_guard <std::mutex> lock(mMutex);
+        mClosed = true;
+
+    }
+
+    mWriterWake.notify_one();
+    mThread.join();
+
+}
+
+
+/*
+
+The side that goes to sleep raises its flag before it checks the condition under
+the lock, the other side advances its index before it looks at the flag. With
+sequentially consistent atomics one of them always sees the other, so a wake up
+is never lost.
+
+*/
+template <typename Predicate>
+void AsyncWriter::waitProducer(Predicate ready)
+{
+
+    if(ready())
+        return;
+
+    std::unique_lock <std::mutex> lock(mMutex);
+
+    mProducerWaiting = true;
+    mProducerWake.wait(lock,ready);
+    mProducerWaiting = false;
+
+}
+
+
+char *AsyncWriter::reserve(std::size_t maxSize,std::size_t &size)
+{
+
+    const std::size_t head = mHead.load(std::memory_order_relaxed);
+
+    waitProducer([&]() { return head - mTail.load() < mCapacity; });
+
+    const std::size_t offset = head & (mCapacity - 1);
+
+    size = std::min(std::min(maxSize,mCapacity - offset),mCapacity - (head - mTail.load()));
+
+    return mRing.get() + offset;
+
+}
+
+
+void AsyncWriter::commit(std::size_t size)
+{
+
+    if(!size)
+        return;
+
+    mHead.store(mHead.load(std::memory_order_relaxed) + size);
+
+    if(mWriterWaiting)
+    {
+
+        std::lock_guard <std::mutex> lock(mMutex);
+        mWriterWake.notify_one();
+
+    }
+
+}
+
+
+bool AsyncWriter::drain()
+{
+
+    const std::size_t head = mHead.load(std::memory_order_relaxed);
+
+    waitProducer([&]() { return mTail.load() == head; });
+
+    return !mFailed;
+
+}
+
+
+void AsyncWriter::run()
+{
+
+    while(true)
+    {
+
+        std::size_t tail = mTail.load(std::memory_order_relaxed);
+        std::size_t head = mHead.load();
+
+        if(head == tail)
+        {
+
+            std::unique_lock <std::mutex> lock(mMutex);
+
+            mWriterWaiting = true;
+            mWriterWake.wait(lock,[&]() { return mHead.load() != tail || mClosed; });
+            mWriterWaiting = false;
+
+            head = mHead.load();
+
+            // Everything committed before closing is still written
+            if(head == tail)
+                return;
+
+        }
+
+        // The pending bytes wrap around the end of the ring at most once
+        const std::size_t offset = tail & (mCapacity - 1);
+        const std::size_t first = std::min(head - tail,mCapacity - offset);
+
+        iovec parts[2] = {{mRing.get() + offset,first},{mRing.get(),head - tail - first}};
+        ssize_t written = 0;
+
+        if(!mFailed)
+        {
+
+            do
+                written = writev(mFd,parts,parts[1].iov_len ? 2 : 1);
+            while(written < 0 && errno == EINTR);
+
+            if(written < 0)
+                mFailed = true;
+
+        }
+
+        mTail.store(mFailed ? head : tail + written);
+
+        if(mProducerWaiting)
+        {
+
+            std::lock_guard <std::mutex> lock(mMutex);
+            mProducerWake.notify_one();
+
+        }
+
+    }
+
+}
@@ -0,0 +1,68 @@
+#ifndef ASYNC_WRITER_HPP
+#define ASYNC_WRITER_HPP
+
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstddef>
+
+/*
+
+Single producer, single consumer ring buffer drained to a file descriptor by a
+thread of its own. The producer writes into the space handed out by reserve and
+publishes it with commit, the writer thread empties the ring with one writev per
+turn. Head and tail are only ever advanced by their own side, so neither takes a
+lock while there is data and space. The lock is only used to sleep on an empty
+or a full ring.
+
+*/
+class AsyncWriter
+{
+
+public:
+
+    // capacity has to be a power of two
+    AsyncWriter(int fd,std::size_t capacity);
+    // Writes what is left and stops the thread
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter &) = delete;
+    AsyncWriter &operator=(const AsyncWriter &) = delete;
+
+    // Contiguous free space at the end of the data, at most maxSize bytes, waits while the ring is full
+    char *reserve(std::size_t maxSize,std::size_t &size);
+    // Hands size bytes of the reserved space to the writer thread, in order
+    void commit(std::size_t size);
+    // Waits until everything committed is written, false when a write failed
+    bool drain();
+
+private:
+
+    void run();
+
+    template <typename Predicate>
+    void waitProducer(Predicate ready);
+
+    std::unique_ptr<char[]> mRing;
+    std::size_t mCapacity;
+    int mFd;
+
+    // Bytes committed and bytes written since the start, the difference is in the ring
+    std::atomic<std::size_t> mHead;
+    std::atomic<std::size_t> mTail;
+    // Output after a failed write is dropped
+    std::atomic<bool> mFailed;
+    std::atomic<bool> mClosed;
+    std::atomic<bool> mProducerWaiting;
+    std::atomic<bool> mWriterWaiting;
+
+    std::mutex mMutex;
+    std::condition_variable mProducerWake;
+    std::condition_variable mWriterWake;
+    std::thread mThread;
+
+};
+
+#endif
@@ -0,0 +1,362 @@
+#include "Batch.hpp"
+#include "Execution.hpp"
+#include "Watchdog.hpp"
+#include <algorithm>
+#include <streambuf>
+#include <ostream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+#include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
+
+
+namespace
+{
+
+// Output a record holds while an older one is still being written
+const std::size_t heldOutputSize = std::size_t(1) << 20;
+
+// Records of a running batch, shared by the workers and the writer under mutex
+struct Window
+{
+
+    struct Record
+    {
+
+        bool done;
+        // Stopped by a step or time limit
+        bool limited;
+        // Not written yet
+        std::string output;
+        std::string error;
+
+        Record():done(false),limited(false){}
+
+    };
+
+    Window(std::size_t count,std::ostream &stream):records(count),next(0),writePos(0),out(stream){}
+
+    std::vector <Record> records;
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::condition_variable written;
+    // First record not claimed and first record not written
+    std::size_t next;
+    std::size_t writePos;
+    std::ostream &out;
+
+};
+
+/*
+
+Output of one record. The record at writePos writes straight to out, an
+earlier one still running holds its output until it gets there, and waits
+when that would take more than heldOutputSize.
+
+*/
+class RecordOutput : public std::streambuf
+{
+
+public:
+
+    RecordOutput(Window &window,std::size_t record):mWindow(window),mRecord(record){}
+
+protected:
+
+    int_type overflow(int_type ch) override
+    {
+
+        if(!traits_type::eq_int_type(ch,traits_type::eof()))
+        {
+
+            const char byte = traits_type::to_char_type(ch);
+            xsputn(&byte,1);
+
+        }
+
+        return traits_type::not_eof(ch);
+
+    }
+
+    std::streamsize xsputn(const char *data,std::streamsize size) override
+    {
+
+        std::unique_lock <std::mutex> lock(mWindow.mutex);
+        std::string &held = mWindow.records[mRecord].output;
+
+        mWindow.written.wait(lock,[&]()
+        {
+
+            return mWindow.writePos == mRecord || held.size() + static_cast<std::size_t>(size) <= heldOutputSize;
+
+        });
+
+        if(mWindow.writePos != mRecord)
+        {
+
+            held.append(data,static_cast<std::size_t>(size));
+            return size;
+
+        }
+
+        // The writer waits for this record to finish, nobody else writes to out meanwhile
+        std::string earlier;
+        earlier.swap(held);
+        lock.unlock();
+
+        mWindow.out.write(earlier.data(),earlier.size());
+        mWindow.out.write(data,size);
+
+        return size;
+
+    }
+
+private:
+
+    Window &mWindow;
+    std::size_t mRecord;
+
+};
+
+}
+
+
+std::unique_ptr<Batch> Batch::open(const std::string &path,char delimiter)
+{
+
+    struct stat info;
+
+    if(stat(path.c_str(),&info) != 0)
+        throw std::runtime_error("Could not open the batch: " + path);
+
+    std::unique_ptr<Batch> batch(new Batch);
+
+    if(S_ISDIR(info.st_mode))
+    {
+
+        DIR *dir = opendir(path.c_str());
+
+        if(!dir)
+            throw std::runtime_error("Could not open the directory: " + path);
+
+        while(dirent *entry = readdir(dir))
+        {
+
+            const std::string file = path + "/" + entry->d_name;
+
+            if(stat(file.c_str(),&info) == 0 && S_ISREG(info.st_mode))
+                batch->mFiles.push_back(file);
+
+        }
+
+        closedir(dir);
+        std::sort(batch->mFiles.begin(),batch->mFiles.end());
+
+        if(batch->mFiles.empty())
+            throw std::runtime_error("No files in the directory: " + path);
+
+    }
+
+    else
+    {
+
+        batch->mSource.reset(new SourceFile(path));
+
+        const char *data = batch->mSource->data();
+        const std::size_t size = batch->mSource->size();
+        std::size_t start = 0;
+
+        while(start < size)
+        {
+
+            const void *found = std::memchr(data + start,delimiter,size - start);
+            const std::size_t end = found ? static_cast<const char *>(found) - data : size;
+
+            batch->mRecords.push_back(std::make_pair(start,end - start));
+            start = end + 1;
+
+        }
+
+        // An empty file holds one empty record
+        if(batch->mRecords.empty())
+            batch->mRecords.push_back(std::make_pair(0,0));
+
+    }
+
+    return batch;
+
+}
+
+
+std::unique_ptr<InputSource> Batch::input(std::size_t record) const
+{
+
+    if(!mFiles.empty())
+        return InputSource::openFile(mFiles[record]);
+
+    return InputSource::fromMemory(mSource->data() + mRecords[record].first,mRecords[record].second);
+
+}
+
+
+std::string Batch::name(std::size_t record) const
+{
+
+    return mFiles.empty() ? "record " + std::to_string(record + 1) : mFiles[record];
+
+}
+
+
+Batch::Summary Batch::run(const Program &program,unsigned threads,std::ostream &out,std::ostream &errors) const
+{
+
+    const std::size_t count = size();
+    // Records claimed ahead of the writer, bounds the outputs held in memory
+    const std::size_t window = 4 * static_cast<std::size_t>(threads);
+
+    Window state(count,out);
+
+    // Workers only share the claim and hand over of records, a run touches nothing shared
+    const auto worker = [&]()
+    {
+
+        for(;;)
+        {
+
+            std::size_t record;
+
+            {
+
+                std::unique_lock <std::mutex> lock(state.mutex);
+                state.written.wait(lock,[&]() { return state.next == count || state.next - state.writePos < window; });
+
+                if(state.next == count)
+                    return;
+
+                record = state.next++;
+
+            }
+
+            RecordOutput buffer(state,record);
+            std::ostream output(&buffer);
+            std::string error;
+            bool limited = false;
+
+            try
+            {
+
+                Execution execution(program,input(record),
+                    std::unique_ptr<OutputSink>(new OutputSink(output,OutputSink::FlushPolicy::full)));
+                execution.run();
+
+            }
+            catch(const LimitExceeded &e)
+            {
+
+                error = e.what();
+                limited = true;
+
+            }
+            catch(const std::exception &e)
+            {
+
+                error = e.what();
+
+            }
+
+            {
+
+                std::lock_guard <std::mutex> lock(state.mutex);
+
+                state.records[record].error = std::move(error);
+                state.records[record].limited = limited;
+                state.records[record].done = true;
+
+            }
+
+            state.finished.notify_one();
+
+        }
+
+    };
+
+    std::vector <std::thread> workers;
+
+    try
+    {
+
+        for(unsigned i = 0; i < threads && i < count; ++i)
+            workers.emplace_back(worker);
+
+    }
+    catch(...)
+    {
+
+        {
+
+            std::lock_guard <std::mutex> lock(state.mutex);
+            state.next = count;
+
+        }
+
+        state.written.notify_all();
+
+        for(auto &thread : workers)
+            thread.join();
+
+        throw;
+
+    }
+
+    Summary summary = {0,0};
+
+    // Only this thread moves writePos, the worker of the record there writes to out itself
+    while(state.writePos < count)
+    {
+
+        Window::Record result;
+
+        {
+
+            std::unique_lock <std::mutex> lock(state.mutex);
+            state.finished.wait(lock,[&]() { return state.records[state.writePos].done; });
+
+            result = std::move(state.records[state.writePos]);
+
+        }
+
+        // What the record held before its turn, the next record streams only after it
+        out.write(result.output.data(),result.output.size());
+
+        if(!result.error.empty())
+        {
+
+            out.flush();
+            errors << "Error in " << name(state.writePos) << ": " << result.error << "\n";
+            ++summary.failed;
+            summary.limited += result.limited;
+
+        }
+
+        {
+
+            std::lock_guard <std::mutex> lock(state.mutex);
+            ++state.writePos;
+
+        }
+
+        state.written.notify_all();
+
+    }
+
+    out.flush();
+
+    for(auto &thread : workers)
+        thread.join();
+
+    return summary;
+
+}
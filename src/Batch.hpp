@@ -0,0 +1,72 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iosfwd>
+#include <cstddef>
+#include "Program.hpp"
+#include "InputSource.hpp"
+#include "SourceFile.hpp"
+
+/*
+
+Inputs of a batch run, the program runs once over each record.
+Records are the regular files of a directory, in name order, or the parts of a
+file separated by a delimiter. Workers run records side by side, each with its
+own tape, input and output, and the outputs are written in record order. The
+oldest unwritten record streams its output, the ones after it hold a bounded
+amount and wait for their turn when it fills up.
+
+*/
+class Batch
+{
+
+public:
+
+    // Directory or delimited file, a delimiter that ends the file does not start another record
+    static std::unique_ptr<Batch> open(const std::string &path,char delimiter);
+
+    Batch(const Batch &) = delete;
+    Batch &operator=(const Batch &) = delete;
+
+    std::size_t size() const { return mFiles.empty() ? mRecords.size() : mFiles.size(); }
+
+    struct Summary
+    {
+
+        std::size_t failed;
+        // Failed records stopped by a step or time limit
+        std::size_t limited;
+
+    };
+
+    /*
+
+    Runs the program over every record with the given number of workers.
+    A failed record reports to errors and does not stop the others, its output up
+    to the failure is still written. Returns how many records failed and how
+    many of those went over a limit.
+
+    */
+    Summary run(const Program &program,unsigned threads,std::ostream &out,std::ostream &errors) const;
+
+private:
+
+    Batch() = default;
+
+    std::unique_ptr<InputSource> input(std::size_t record) const;
+    // File name or record number, for error messages
+    std::string name(std::size_t record) const;
+
+    // Records of a directory
+    std::vector <std::string> mFiles;
+    // Records of a delimited file, start and size of each in mSource
+    std::unique_ptr<SourceFile> mSource;
+    std::vector <std::pair<std::size_t,std::size_t>> mRecords;
+
+};
+
+#endif
@@ -0,0 +1,306 @@
+#include "Interpreter.hpp"
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include <cstdint>
+
+
+void Interpreter::emitC(const SourceFile &sourceFile,const Options &options,const std::string &filename)
+{
+
+    if(!validCellBits(options.cellBits))
+        throw std::runtime_error("Invalid cell size " + std::to_string(options.cellBits));
+
+    init(options);
+    mCodeReused = true;
+    parseFile(sourceFile.data(),sourceFile.size(),options.debugMode);
+    performOptimizations();
+
+    std::ofstream file(filename.c_str());
+
+    if(!file.is_open())
+        throw std::runtime_error("Could not open the file: " + filename);
+
+    writeC(file);
+
+    if(!file)
+        throw std::runtime_error("Could not write the file: " + filename);
+
+}
+
+
+/*
+
+Writes the optimized code as a standalone C program.
+Block offsets and pointer moves become constant offsets of the accesses,
+the pointer itself is only updated at loop boundaries and scans.
+
+*/
+void Interpreter::writeC(std::ostream &out)
+{
+
+    const unsigned cellBits = mOptions.cellBits;
+
+    std::string indent = "    ";
+    std::int64_t pendingOffset = 0;
+    const std::uint64_t cellMask = cellBits == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << cellBits) - 1;
+
+    // Cell value, negative values wrap the same way they do in the interpreter
+    auto constant = [&](std::int32_t value)
+    {
+
+        return std::to_string(static_cast<std::uint64_t>(value) & cellMask) + (cellBits == 64 ? "ull" : "u");
+
+    };
+
+    auto cell = [&](std::int64_t offset)
+    {
+
+        return "p[" + std::to_string(pendingOffset + offset) + "]";
+
+    };
+
+    auto materialize = [&]()
+    {
+
+        if(pendingOffset)
+            out << indent << "p += " << pendingOffset << ";\n";
+
+        pendingOffset = 0;
+
+    };
+
+    out << "/* Generated by bf */\n\n";
+    out << "#include <stdio.h>\n";
+    out << "#include <string.h>\n";
+    out << "#include <stdint.h>\n\n";
+    out << "typedef uint" << cellBits << "_t cell;\n\n";
+    // Same layout as the interpreter, arraySize cells on each side of the start
+    out << "#define ARRAY_SIZE " << mOptions.arraySize << "\n\n";
+    out << "static cell tape[2 * ARRAY_SIZE];\n\n";
+    bool hasTripCount = false;
+    bool hasDebug = false;
+
+    for(const auto &instr : mCode)
+    {
+
+        hasTripCount |= instr.opcode == OPtripCount;
+        hasDebug |= instr.opcode == OPdebug;
+
+    }
+
+    // Same computation as Interpreter::tripCount, narrow cells are computed as unsigned
+    if(hasTripCount)
+    {
+
+        const std::string arithmetic = cellBits < 32 ? "unsigned" : "cell";
+
+        out << "static int trip_count(cell *counter, cell step)\n{\n\n";
+        out << indent << arithmetic << " odd = step, inverse, negated;\n";
+        out << indent << "unsigned shift = 0;\n";
+        out << indent << "int i;\n\n";
+        out << indent << "if(!*counter) return 1;\n";
+        out << indent << "if(!odd) return 0;\n";
+        out << indent << "while(!(odd & 1)) { odd >>= 1; ++shift; }\n";
+        out << indent << "if(*counter & ((" << arithmetic << ")1 << shift) - 1) return 0;\n\n";
+        out << indent << "inverse = odd;\n";
+        out << indent << "for(i = 0; i < 5; ++i) inverse *= 2 - odd * inverse;\n\n";
+        out << indent << "negated = (cell)-*counter;\n";
+        out << indent << "*counter = (cell)((negated >> shift) * inverse) & (cell)~(cell)0 >> shift;\n\n";
+        out << indent << "return 1;\n\n";
+        out << "}\n\n";
+
+    }
+
+    // Results of the prefix evaluated at compile time
+    if(!mPrefixOutput.empty())
+    {
+
+        static const char digits[] = "01234567";
+
+        out << "static const char prefix_output[] =\n" << indent << "\"";
+
+        for(std::size_t i = 0; i < mPrefixOutput.size(); ++i)
+        {
+
+            const unsigned char ch = mPrefixOutput[i];
+
+            // Three digit octal escapes, so a following digit is never part of them
+            if(ch >= ' ' && ch <= '~' && ch != '\\' && ch != '"' && ch != '?')
+                out << ch;
+
+            else
+                out << '\\' << digits[ch >> 6] << digits[(ch >> 3) & 7] << digits[ch & 7];
+
+            if(ch == '\n' && i + 1 < mPrefixOutput.size())
+                out << "\"\n" << indent << "\"";
+
+        }
+
+        out << "\";\n\n";
+
+    }
+
+    if(!mPrefixTape.empty())
+    {
+
+        out << "static const cell prefix_tape[] =\n{\n\n";
+
+        for(std::size_t i = 0; i < mPrefixTape.size(); ++i)
+            out << (i % 8 ? " " : indent) << (mPrefixTape[i] & cellMask) << (cellBits == 64 ? "ull" : "u")
+                << (i + 1 < mPrefixTape.size() ? "," : "") << (i % 8 == 7 || i + 1 == mPrefixTape.size() ? "\n" : "");
+
+        out << "\n};\n\n";
+
+    }
+
+    out << "int main(void)\n{\n\n";
+    out << indent << "cell *p = tape + ARRAY_SIZE;\n";
+    out << indent << "int c;\n";
+
+    // Debug stops wait on the terminal like the debugger does, the program keeps its input
+    if(hasDebug)
+        out << indent << "FILE *tty = fopen(\"/dev/tty\", \"r\");\n";
+
+    out << "\n" << indent << "(void)p;\n";
+    out << indent << "(void)c;\n\n";
+
+    for(const auto &instr : mCode)
+    {
+
+        if(instr.opcode == OPend)
+        {
+
+            // bf terminates its output with a newline
+            out << "\n" << indent << "putchar('\\n');\n";
+            out << indent << "return 0;\n\n";
+            out << "}\n";
+
+            break;
+
+        }
+
+        // Offset of the addressed cell from the pointer
+        std::int64_t offset = 0;
+
+        if(endsBlock(instr.opcode))
+            pendingOffset += instr.parameter3;
+
+        else
+            offset = instr.parameter3;
+
+        if(instr.parameter4)
+            out << indent << cell(offset) << " += " << constant(instr.parameter4) << ";\n";
+
+        switch(instr.opcode)
+        {
+
+        case OPeditVal:
+
+            out << indent << cell(offset) << " += " << constant(instr.parameter) << ";\n";
+
+            break;
+
+        case OPmovePtr:
+
+            pendingOffset += instr.parameter;
+
+            break;
+
+        case OPjumpOnZero:
+
+            materialize();
+            out << indent << "while(*p)\n" << indent << "{\n";
+            indent += "    ";
+
+            break;
+
+        case OPjumpOnNonZero:
+
+            materialize();
+            indent.resize(indent.size() - 4);
+            out << indent << "}\n";
+
+            break;
+
+        case OPmulAdd:
+        case OPmulAddZero:
+
+            out << indent << "if(" << cell(offset) << ") " << cell(offset + instr.parameter) << " += "
+                << cell(offset) << " * " << constant(instr.parameter2) << ";\n";
+
+            if(instr.opcode == OPmulAddZero)
+                out << indent << cell(offset) << " = 0;\n";
+
+            break;
+
+        case OPproduct:
+
+            out << indent << "if(" << cell(offset) << ") " << cell(offset + lowHalf(instr.parameter)) << " += " << cell(offset)
+                << " * (" << cell(offset + highHalf(instr.parameter)) << " * " << constant(instr.parameter2) << ");\n";
+
+            break;
+
+        case OPsetZero:
+
+            out << indent << cell(offset) << " = 0;\n";
+
+            break;
+
+        case OPfindZero:
+
+            materialize();
+            out << indent << "while(*p) p += " << instr.parameter << ";\n";
+
+            break;
+
+        case OPtripCount:
+
+            // The loop never ends
+            out << indent << "if(!trip_count(&" << cell(offset) << ", " << constant(instr.parameter) << ")) for(;;);\n";
+
+            break;
+
+        case OPwrite:
+
+            out << indent << "fwrite(prefix_output, 1, sizeof prefix_output - 1, stdout);\n";
+
+            break;
+
+        case OPloadTape:
+
+            out << indent << "memcpy(&" << cell(offset) << ", prefix_tape, sizeof prefix_tape);\n";
+
+            break;
+
+        case OPprint:
+
+            out << indent << "putchar((unsigned char)" << cell(offset) << ");\n";
+
+            break;
+
+        case OPread:
+
+            out << indent << "fflush(stdout);\n";
+            out << indent << "if((c = getchar()) != EOF) " << cell(offset) << " = (cell)c;\n";
+
+            break;
+
+        case OPdebug:
+
+            out << indent << "fprintf(stderr,\"Position within the code: " << instr.parameter << "\\n\");\n";
+            out << indent << "fprintf(stderr,\"Pointer value: %ld\\n\",(long)(&" << cell(offset) << " - (tape + ARRAY_SIZE)));\n";
+            out << indent << "fprintf(stderr,\"Value at pointer: %llu\\n\",(unsigned long long)" << cell(offset) << ");\n";
+            out << indent << "fflush(stdout);\n";
+            out << indent << "if(tty) while((c = getc(tty)) != EOF && c != '\\n');\n";
+
+            break;
+
+        default:
+            break;
+
+        }
+
+    }
+
+}
@@ -0,0 +1,298 @@
+#include "Interpreter.hpp"
+#include "MappedFile.hpp"
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace
+{
+
+// Bumped whenever the layout of the file or the meaning of the code changes
+const std::uint32_t cacheVersion = 3;
+const char cacheMagic[4] = {'B','F','P','C'};
+// Written in native order, a file from a machine of the other order does not match
+const std::uint32_t byteOrderMark = 0x01020304;
+// Fields of an Instruction, stored as 32-bit values
+const std::size_t instructionFields = 5;
+const std::size_t instructionBytes = instructionFields * 4;
+
+/*
+
+Start of a cache file. The instructions follow it, then their 32-bit source positions
+when the run that stored it kept them, the prefix output bytes and the prefix tape cells.
+checksum covers everything after the header.
+
+*/
+struct CacheHeader
+{
+
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint32_t cellBits;
+    std::uint64_t arraySize;
+    // Hash of the source and of the options that shape the code
+    std::uint64_t key;
+    std::uint64_t sourceSize;
+    std::uint64_t instructions;
+    // Zero or the number of instructions
+    std::uint64_t sourcePositions;
+    std::uint64_t prefixOutput;
+    std::uint64_t prefixTape;
+    std::uint64_t checksum;
+
+};
+
+static_assert(sizeof(CacheHeader) == 80,"The cache header must not have padding");
+
+std::uint64_t fnv1a(std::uint64_t hash,const char *data,std::size_t size)
+{
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3;
+
+    }
+
+    return hash;
+
+}
+
+const std::uint64_t fnvBasis = 0xcbf29ce484222325;
+
+}
+
+
+std::string Interpreter::cachePath(const char *source,std::size_t size,std::uint64_t &key) const
+{
+
+    // Everything the parser and the passes read, the engine only matters after lowering
+    std::string options = "c" + std::to_string(mOptions.cellBits) + " s" + std::to_string(mOptions.arraySize) +
+        " O" + std::to_string(mOptions.optLevel) + (mOptions.debugMode ? " d" : "") + (mOptions.profile ? " p" : "") +
+        (mOptions.maxSteps ? " l" : "") + (mOptions.verifyFolds ? " v" : "");
+
+    for(const auto &name : mOptions.enabledPasses)
+        options += " +" + name;
+
+    for(const auto &name : mOptions.disabledPasses)
+        options += " -" + name;
+
+    if(mOptions.debugMode)
+        for(auto offset : mOptions.breakpoints)
+            options += " b" + std::to_string(offset);
+
+    key = fnv1a(fnv1a(fnvBasis,source,size),options.data(),options.size());
+
+    char name[17];
+    const char digits[] = "0123456789abcdef";
+
+    for(int i = 0; i < 16; ++i)
+        name[i] = digits[(key >> (60 - 4 * i)) & 0xF];
+
+    name[16] = '\0';
+
+    return mOptions.cacheDir + "/" + name + ".bfc";
+
+}
+
+
+bool Interpreter::loadCached(const char *source,std::size_t size)
+{
+
+    std::uint64_t key;
+    const std::string path = cachePath(source,size,key);
+
+    int fd = open(path.c_str(),O_RDONLY);
+
+    if(fd < 0)
+        return false;
+
+    std::unique_ptr<MappedFile> mapping;
+    std::size_t fileSize;
+
+    try
+    {
+
+        if(MappedFile::mappable(fd,fileSize) && fileSize >= sizeof(CacheHeader))
+            mapping.reset(new MappedFile(fd,fileSize));
+
+    }
+    catch(const std::exception &)
+    {}
+
+    close(fd);
+
+    if(!mapping)
+        return false;
+
+    CacheHeader header;
+    std::memcpy(&header,mapping->data(),sizeof(header));
+
+    // Entries of other versions, options or sources are stale
+    if(std::memcmp(header.magic,cacheMagic,sizeof(cacheMagic)) != 0 || header.version != cacheVersion ||
+        header.byteOrder != byteOrderMark || header.cellBits != mOptions.cellBits ||
+        header.arraySize != mOptions.arraySize || header.key != key || header.sourceSize != size)
+        return false;
+
+    const std::uint64_t payload = fileSize - sizeof(header);
+    const char *data = mapping->data() + sizeof(header);
+
+    // Counts are checked one at a time, so a corrupted one can not overflow the sum
+    if(header.instructions > payload / instructionBytes)
+        return false;
+
+    std::uint64_t rest = payload - header.instructions * instructionBytes;
+
+    // A run that needs the positions can not use an entry without them
+    if((header.sourcePositions != 0 && header.sourcePositions != header.instructions) ||
+        (keepSourcePositions() && !header.sourcePositions) || header.sourcePositions > rest / 4)
+        return false;
+
+    rest -= header.sourcePositions * 4;
+
+    if(header.prefixOutput > rest || rest - header.prefixOutput != header.prefixTape * 8 ||
+        header.checksum != fnv1a(fnvBasis,data,payload))
+        return false;
+
+    Code code(header.instructions);
+
+    for(auto &instr : code)
+    {
+
+        std::int32_t fields[instructionFields];
+        std::memcpy(fields,data,sizeof(fields));
+        data += sizeof(fields);
+
+        if(fields[0] < 0 || fields[0] > OPend)
+            return false;
+
+        instr.opcode = static_cast<Opcode>(fields[0]);
+        instr.parameter = fields[1];
+        instr.parameter2 = fields[2];
+        instr.parameter3 = fields[3];
+        instr.parameter4 = fields[4];
+
+        if((instr.opcode == OPjumpOnZero || instr.opcode == OPjumpOnNonZero) &&
+            (instr.parameter < 0 || static_cast<std::uint64_t>(instr.parameter) >= header.instructions))
+            return false;
+
+    }
+
+    if(code.empty() || code.back().opcode != OPend)
+        return false;
+
+    SourcePositions positions;
+
+    if(keepSourcePositions())
+    {
+
+        positions.resize(header.sourcePositions);
+        std::memcpy(positions.data(),data,header.sourcePositions * 4);
+
+    }
+
+    data += header.sourcePositions * 4;
+
+    mCode.swap(code);
+    mSourcePos.swap(positions);
+    mPrefixOutput.assign(data,header.prefixOutput);
+    data += header.prefixOutput;
+    mPrefixTape.resize(header.prefixTape);
+
+    if(!mPrefixTape.empty())
+        std::memcpy(mPrefixTape.data(),data,header.prefixTape * 8);
+
+    return true;
+
+}
+
+
+void Interpreter::storeCached(const char *source,std::size_t size) const
+{
+
+    CacheHeader header;
+    const std::string path = cachePath(source,size,header.key);
+
+    std::memcpy(header.magic,cacheMagic,sizeof(cacheMagic));
+    header.version = cacheVersion;
+    header.byteOrder = byteOrderMark;
+    header.cellBits = mOptions.cellBits;
+    header.arraySize = mOptions.arraySize;
+    header.sourceSize = size;
+    header.instructions = mCode.size();
+    header.sourcePositions = mSourcePos.size();
+    header.prefixOutput = mPrefixOutput.size();
+    header.prefixTape = mPrefixTape.size();
+
+    std::vector <char> file(sizeof(header) + mCode.size() * instructionBytes + mSourcePos.size() * 4 +
+        mPrefixOutput.size() + mPrefixTape.size() * 8);
+    char *data = file.data() + sizeof(header);
+
+    for(const auto &instr : mCode)
+    {
+
+        const std::int32_t fields[instructionFields] = {instr.opcode,instr.parameter,instr.parameter2,instr.parameter3,
+            instr.parameter4};
+
+        std::memcpy(data,fields,sizeof(fields));
+        data += sizeof(fields);
+
+    }
+
+    if(!mSourcePos.empty())
+        std::memcpy(data,mSourcePos.data(),mSourcePos.size() * 4);
+
+    data += mSourcePos.size() * 4;
+    std::memcpy(data,mPrefixOutput.data(),mPrefixOutput.size());
+    data += mPrefixOutput.size();
+
+    if(!mPrefixTape.empty())
+        std::memcpy(data,mPrefixTape.data(),mPrefixTape.size() * 8);
+
+    header.checksum = fnv1a(fnvBasis,file.data() + sizeof(header),file.size() - sizeof(header));
+    std::memcpy(file.data(),&header,sizeof(header));
+
+    // A missing directory is created, its parent has to exist
+    if(mkdir(mOptions.cacheDir.c_str(),0777) != 0 && errno != EEXIST)
+        return;
+
+    // Written aside and renamed over the entry, concurrent runs never see a partial file
+    const std::string temporary = path + "." + std::to_string(getpid()) + ".tmp";
+    int fd = open(temporary.c_str(),O_WRONLY | O_CREAT | O_TRUNC,0666);
+
+    if(fd < 0)
+        return;
+
+    const char *pos = file.data();
+    std::size_t left = file.size();
+
+    while(left)
+    {
+
+        const ssize_t count = write(fd,pos,left);
+
+        if(count < 0 && errno == EINTR)
+            continue;
+
+        if(count <= 0)
+            break;
+
+        pos += count;
+        left -= count;
+
+    }
+
+    if(close(fd) != 0 || left || rename(temporary.c_str(),path.c_str()) != 0)
+        unlink(temporary.c_str());
+
+}
@@ -0,0 +1,74 @@
+#include "Debugger.hpp"
+#include <sstream>
+
+
+Debugger::Debugger(std::size_t arraySize):mArraySize(arraySize),mDetached(false)
+{}
+
+
+bool Debugger::readLine(std::string &line)
+{
+
+    line.clear();
+
+    int ch;
+
+    while((ch = mControl->get()) != InputSource::eof && ch != '\n')
+        line.push_back(static_cast<char>(ch));
+
+    return ch != InputSource::eof || !line.empty();
+
+}
+
+
+bool Debugger::readCommand(std::ptrdiff_t &offset)
+{
+
+    std::string line;
+
+    while(true)
+    {
+
+        std::cerr << "(bf) " << std::flush;
+
+        // Nobody left to give commands, the run goes on
+        if(!readLine(line))
+        {
+
+            mDetached = true;
+            return false;
+
+        }
+
+        std::istringstream stream(line);
+        std::string command;
+        stream >> command;
+
+        if(command.empty() || command == "c")
+            return false;
+
+        if(command == "r")
+        {
+
+            mDetached = true;
+            return false;
+
+        }
+
+        if(command == "p")
+        {
+
+            offset = 0;
+
+            if((stream >> std::ws).eof() || (stream >> offset && (stream >> std::ws).eof()))
+                return true;
+
+        }
+
+        std::cerr << "c (or empty line)  continue to the next stop\n";
+        std::cerr << "r                  run to the end without stopping\n";
+        std::cerr << "p [offset]         print the cell at offset from the pointer\n";
+
+    }
+
+}
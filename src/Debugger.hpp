@@ -0,0 +1,78 @@
+#ifndef DEBUGGER_HPP
+#define DEBUGGER_HPP
+
+#include <memory>
+#include <string>
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include "InputSource.hpp"
+#include "OutputSink.hpp"
+
+/*
+
+Stops of a run in debug mode, at '#' and at the breakpoints given by source offset.
+The optimizer keeps every stop in place, so the code between two stops runs fully
+optimized. Commands are read from a control channel of their own, the program
+keeps its input to itself.
+
+*/
+class Debugger
+{
+
+public:
+
+    explicit Debugger(std::size_t arraySize);
+
+    Debugger(const Debugger &) = delete;
+    Debugger &operator=(const Debugger &) = delete;
+
+    // /dev/tty is used when no channel is set before the first stop
+    void setControl(std::unique_ptr<InputSource> control) { mControl = std::move(control); }
+    bool hasControl() const { return mControl != nullptr; }
+
+    // Reports the stop and waits for commands, cell is the one the pointer is on
+    template <typename CellType>
+    void stop(std::int32_t sourcePos,const CellType *cell,const CellType *origin,OutputSink &output)
+    {
+
+        if(mDetached)
+            return;
+
+        const std::ptrdiff_t pointer = cell - origin;
+
+        output.flush();
+        std::cerr << "Position within the code: " << sourcePos << "\n";
+        std::cerr << "Pointer value: " << pointer << "\n";
+        std::cerr << "Value at pointer: " << static_cast<std::uint64_t>(*cell) << "\n";
+
+        std::ptrdiff_t offset;
+
+        while(readCommand(offset))
+        {
+
+            // Cells past the tape would fault, the run could not continue
+            if(pointer + offset < -static_cast<std::ptrdiff_t>(mArraySize) || pointer + offset >= static_cast<std::ptrdiff_t>(mArraySize))
+                std::cerr << "Cell " << pointer + offset << " is outside of the tape\n";
+
+            else
+                std::cerr << "Cell " << pointer + offset << ": " << static_cast<std::uint64_t>(cell[offset]) << "\n";
+
+        }
+
+    }
+
+private:
+
+    // False to continue the run, true with the offset of a cell to print
+    bool readCommand(std::ptrdiff_t &offset);
+    bool readLine(std::string &line);
+
+    std::unique_ptr<InputSource> mControl;
+    std::size_t mArraySize;
+    // Set by the run command or the end of the control input, later stops do not wait
+    bool mDetached;
+
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include "Execution.hpp"
+#include <chrono>
+#include <stdexcept>
+#include <cstdint>
+
+
+Execution::Execution(const Program &program,std::unique_ptr<InputSource> input,std::unique_ptr<OutputSink> output)
+    :mProgram(program),mInput(std::move(input)),mOutput(std::move(output)),
+    mTape(program.options().arraySize,program.options().cellBits / 8,program.mInterpreter.mGuardCells,program.options().hugePages),
+    mFinished(false),mRunTime(0)
+{
+
+    mInput->tie(mOutput.get());
+
+    if(program.options().debugMode)
+    {
+
+        mDebugger.reset(new Debugger(program.options().arraySize));
+        mState.debugger = mDebugger.get();
+
+    }
+
+}
+
+
+void Execution::setDebugControl(std::unique_ptr<InputSource> control)
+{
+
+    if(!mDebugger)
+        throw std::runtime_error("The program was not compiled for debugging");
+
+    control->tie(mOutput.get());
+    mDebugger->setControl(std::move(control));
+
+}
+
+
+void Execution::run()
+{
+
+    if(mFinished)
+        throw std::runtime_error("The execution has already run");
+
+    mFinished = true;
+
+    if(mDebugger && !mDebugger->hasControl())
+        setDebugControl(InputSource::openFile("/dev/tty"));
+
+    typedef std::chrono::steady_clock Clock;
+
+    const Interpreter &interpreter = mProgram.mInterpreter;
+    const Clock::time_point start = Clock::now();
+
+    if(mProgram.options().maxSteps || mProgram.options().timeout > 0)
+    {
+
+        mWatchdog.reset(new Watchdog(mProgram.options().maxSteps,mProgram.options().timeout,mTape));
+        mState.watchdog = mWatchdog.get();
+        mInput->watch(mWatchdog.get());
+
+    }
+
+    switch(mProgram.options().cellBits)
+    {
+
+    case 8:
+
+        interpreter.execute<std::uint8_t>(*mInput,*mOutput,mTape,mState);
+
+        break;
+
+    case 16:
+
+        interpreter.execute<std::uint16_t>(*mInput,*mOutput,mTape,mState);
+
+        break;
+
+    case 32:
+
+        interpreter.execute<std::uint32_t>(*mInput,*mOutput,mTape,mState);
+
+        break;
+
+    case 64:
+
+        interpreter.execute<std::uint64_t>(*mInput,*mOutput,mTape,mState);
+
+        break;
+
+    }
+
+    mOutput->flush();
+    mRunTime = std::chrono::duration<double>(Clock::now() - start).count();
+
+}
+
+
+void Execution::reportProfile(std::ostream &out) const
+{
+
+    if(!mProgram.options().profile)
+        throw std::runtime_error("The program was not compiled for profiling");
+
+    mProgram.mInterpreter.reportProfile(mState.counts,out);
+
+}
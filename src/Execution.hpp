@@ -0,0 +1,58 @@
+#ifndef EXECUTION_HPP
+#define EXECUTION_HPP
+
+#include <memory>
+#include <iosfwd>
+#include "Program.hpp"
+#include "InputSource.hpp"
+#include "OutputSink.hpp"
+#include "Tape.hpp"
+#include "Debugger.hpp"
+#include "Watchdog.hpp"
+
+/*
+
+One run of a compiled program, with its own tape, input and output.
+The program has to outlive the execution. An execution runs once, running the
+program on another input takes another execution.
+
+*/
+class Execution
+{
+
+public:
+
+    Execution(const Program &program,std::unique_ptr<InputSource> input,std::unique_ptr<OutputSink> output);
+
+    Execution(const Execution &) = delete;
+    Execution &operator=(const Execution &) = delete;
+
+    // Channel the debugger reads its commands from, /dev/tty when not set
+    void setDebugControl(std::unique_ptr<InputSource> control);
+
+    // Runs the program to its end, the output is flushed when it returns. Throws LimitExceeded when the run hits a limit
+    void run();
+
+    // Seconds spent in run
+    double runTime() const { return mRunTime; }
+
+    // Prints the hot loops of the run, the program has to be compiled with profiling enabled
+    void reportProfile(std::ostream &out) const;
+
+private:
+
+    const Program &mProgram;
+    std::unique_ptr<InputSource> mInput;
+    std::unique_ptr<OutputSink> mOutput;
+    Tape mTape;
+    // Only in debug mode
+    std::unique_ptr<Debugger> mDebugger;
+    // Only with a step or time limit, started by run
+    std::unique_ptr<Watchdog> mWatchdog;
+    Interpreter::RunState mState;
+    bool mFinished;
+    double mRunTime;
+
+};
+
+#endif
@@ -0,0 +1,120 @@
+#include "FindZero.hpp"
+#include <cstdint>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define BF_FIND_ZERO_SIMD
+#include <immintrin.h>
+#endif
+
+namespace
+{
+
+template <typename CellType>
+CellType *findZeroScalar(CellType *cell,std::ptrdiff_t step)
+{
+
+    while(*cell)
+        cell += step;
+
+    return cell;
+
+}
+
+}
+
+#if defined(BF_FIND_ZERO_SIMD)
+
+// SSE2 is part of x86-64, no detection needed
+namespace sse2
+{
+
+const std::size_t blockSize = 16;
+
+template <std::size_t cellSize>
+std::uint64_t zeroMask(const char *block)
+{
+
+    const __m128i cells = _mm_load_si128(reinterpret_cast<const __m128i *>(block));
+    const __m128i zero = _mm_setzero_si128();
+
+    if(cellSize == 1)
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(cells,zero)));
+
+    if(cellSize == 2)
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(cells,zero)));
+
+    std::uint64_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi32(cells,zero)));
+
+    // No 64-bit compare in SSE2, both halves of the cell must be zero
+    return cellSize == 4 ? mask : mask & (mask >> 4);
+
+}
+
+#include "FindZeroKernel.hpp"
+
+}
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace avx2
+{
+
+const std::size_t blockSize = 32;
+
+template <std::size_t cellSize>
+std::uint64_t zeroMask(const char *block)
+{
+
+    const __m256i cells = _mm256_load_si256(reinterpret_cast<const __m256i *>(block));
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i equal;
+
+    if(cellSize == 1)
+        equal = _mm256_cmpeq_epi8(cells,zero);
+
+    else if(cellSize == 2)
+        equal = _mm256_cmpeq_epi16(cells,zero);
+
+    else if(cellSize == 4)
+        equal = _mm256_cmpeq_epi32(cells,zero);
+
+    else
+        equal = _mm256_cmpeq_epi64(cells,zero);
+
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+
+}
+
+#include "FindZeroKernel.hpp"
+
+}
+
+#pragma GCC pop_options
+
+#endif
+
+
+template <typename CellType>
+FindZeroFunction<CellType> findZeroFunction()
+{
+
+    #if defined(BF_FIND_ZERO_SIMD)
+
+    static const FindZeroFunction<CellType> function =
+        __builtin_cpu_supports("avx2") ? avx2::findZero<CellType> : sse2::findZero<CellType>;
+
+    return function;
+
+    #else
+
+    return findZeroScalar<CellType>;
+
+    #endif
+
+}
+
+template FindZeroFunction<std::uint8_t> findZeroFunction<std::uint8_t>();
+template FindZeroFunction<std::uint16_t> findZeroFunction<std::uint16_t>();
+template FindZeroFunction<std::uint32_t> findZeroFunction<std::uint32_t>();
+template FindZeroFunction<std::uint64_t> findZeroFunction<std::uint64_t>();
@@ -0,0 +1,14 @@
+#ifndef FIND_ZERO_HPP
+#define FIND_ZERO_HPP
+
+#include <cstddef>
+
+// Returns the first zero cell among cell, cell + step, cell + 2 * step, ...
+template <typename CellType>
+using FindZeroFunction = CellType *(*)(CellType *cell,std::ptrdiff_t step);
+
+// Fastest implementation the CPU supports, detected on the first call
+template <typename CellType>
+FindZeroFunction<CellType> findZeroFunction();
+
+#endif
@@ -0,0 +1,84 @@
+/*
+
+Vectorized zero scan, included once per instruction set by FindZero.cpp.
+Intentionally without include guard. The including namespace provides:
+
+    blockSize - bytes per vector, 16 or 32
+    std::uint64_t zeroMask<cellSize>(const char *block) - bit i set when the cell
+        starting at byte i of the aligned block is zero
+
+Only aligned blocks are loaded and a block is loaded only when the scalar scan
+would read a cell in it, so the scan never touches a page the scalar loop would
+not touch.
+
+*/
+
+template <typename CellType>
+CellType *findZero(CellType *cell,std::ptrdiff_t step)
+{
+
+    const std::size_t cellSize = sizeof(CellType);
+    const std::size_t stride = (step < 0 ? -step : step) * cellSize;
+
+    // Wide strides have at most one candidate per block
+    if(!stride || stride > blockSize)
+    {
+
+        while(*cell)
+            cell += step;
+
+        return cell;
+
+    }
+
+    // Bit positions of the candidate cells in a block, pattern counts up from bit 0, reversed down from bit 63
+    std::uint64_t pattern = 0;
+    std::uint64_t reversed = 0;
+
+    for(std::size_t bit = 0; bit < 64; bit += stride)
+    {
+
+        pattern |= std::uint64_t(1) << bit;
+        reversed |= std::uint64_t(1) << (63 - bit);
+
+    }
+
+    const std::uint64_t blockMask = (std::uint64_t(1) << blockSize) - 1;
+    char *block = reinterpret_cast<char *>(reinterpret_cast<std::uintptr_t>(cell) & ~std::uintptr_t(blockSize - 1));
+    std::size_t offset = reinterpret_cast<char *>(cell) - block;
+
+    if(step > 0)
+        while(true)
+        {
+
+            std::uint64_t hits = zeroMask<cellSize>(block) & (pattern << offset) & blockMask;
+
+            if(hits)
+                return reinterpret_cast<CellType *>(block + __builtin_ctzll(hits));
+
+            // First candidate of the next block, constant once it is below the stride if the stride divides the block
+            if(blockSize % stride || offset >= stride)
+                offset = (stride - (blockSize - offset) % stride) % stride;
+
+            block += blockSize;
+
+        }
+
+    else
+        while(true)
+        {
+
+            std::uint64_t hits = zeroMask<cellSize>(block) & (reversed >> (63 - offset));
+
+            if(hits)
+                return reinterpret_cast<CellType *>(block + 63 - __builtin_clzll(hits));
+
+            // Last candidate of the previous block, constant after the first block if the stride divides the block
+            if(blockSize % stride || offset < blockSize - stride)
+                offset = offset % stride + blockSize - stride;
+
+            block -= blockSize;
+
+        }
+
+}
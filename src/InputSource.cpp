@@ -0,0 +1,148 @@
+#include "InputSource.hpp"
+#include "Watchdog.hpp"
+#include <stdexcept>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+InputSource::InputSource():mPos(nullptr),mEnd(nullptr),mFd(-1),mOwnsFd(false),mTie(nullptr),mWatchdog(nullptr)
+{}
+
+
+InputSource::~InputSource()
+{
+
+    if(mOwnsFd)
+        close(mFd);
+
+}
+
+
+std::unique_ptr<InputSource> InputSource::openFile(const std::string &filename)
+{
+
+    int fd = open(filename.c_str(),O_RDONLY);
+
+    if(fd < 0)
+        throw std::runtime_error("Could not open the file: " + filename);
+
+    std::unique_ptr<InputSource> input(new InputSource);
+    std::size_t size;
+
+    if(MappedFile::mappable(fd,size))
+    {
+
+        try
+        {
+
+            input->mMapping.reset(new MappedFile(fd,size));
+
+        }
+        catch(...)
+        {
+
+            close(fd);
+            throw;
+
+        }
+
+        close(fd);
+        input->mPos = input->mMapping->data();
+        input->mEnd = input->mPos + size;
+
+    }
+
+    // Pipes, devices and empty files
+    else
+    {
+
+        input->mFd = fd;
+        input->mOwnsFd = true;
+        input->mBuffer.resize(1 << 16);
+
+    }
+
+    return input;
+
+}
+
+
+std::unique_ptr<InputSource> InputSource::fromString(const std::string &text)
+{
+
+    std::unique_ptr<InputSource> input(new InputSource);
+
+    input->mText = text;
+    input->mPos = input->mText.data();
+    input->mEnd = input->mPos + input->mText.size();
+
+    return input;
+
+}
+
+
+std::unique_ptr<InputSource> InputSource::fromMemory(const char *data,std::size_t size)
+{
+
+    std::unique_ptr<InputSource> input(new InputSource);
+
+    input->mPos = data;
+    input->mEnd = data + size;
+
+    return input;
+
+}
+
+
+std::unique_ptr<InputSource> InputSource::fromStdin()
+{
+
+    std::unique_ptr<InputSource> input(new InputSource);
+
+    input->mFd = STDIN_FILENO;
+    input->mBuffer.resize(1 << 16);
+
+    return input;
+
+}
+
+
+int InputSource::underflow()
+{
+
+    if(mFd < 0)
+        return eof;
+
+    if(mTie)
+        mTie->flush();
+
+    if(mWatchdog)
+        mWatchdog->waitReadable(mFd);
+
+    ssize_t count;
+
+    do
+        count = read(mFd,mBuffer.data(),mBuffer.size());
+    while(count < 0 && errno == EINTR);
+
+    // End of input is final, like eofbit on a stream
+    if(count <= 0)
+    {
+
+        if(mOwnsFd)
+            close(mFd);
+
+        mFd = -1;
+        mOwnsFd = false;
+
+        return eof;
+
+    }
+
+    mPos = mBuffer.data();
+    mEnd = mPos + count;
+
+    return static_cast<unsigned char>(*mPos++);
+
+}
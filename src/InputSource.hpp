@@ -0,0 +1,74 @@
+#ifndef INPUT_SOURCE_HPP
+#define INPUT_SOURCE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "MappedFile.hpp"
+#include "OutputSink.hpp"
+
+class Watchdog;
+
+/*
+
+Program input served from memory.
+Regular files are mapped, strings are used in place and pipes or the console
+are read in large blocks. The tied output sink is flushed before a read that
+may block, and a watchdog with a time limit cuts the wait short.
+
+*/
+class InputSource
+{
+
+public:
+
+    static const int eof = -1;
+
+    static std::unique_ptr<InputSource> openFile(const std::string &filename);
+    static std::unique_ptr<InputSource> fromString(const std::string &text);
+    // Reads the memory in place, it has to outlive the source
+    static std::unique_ptr<InputSource> fromMemory(const char *data,std::size_t size);
+    static std::unique_ptr<InputSource> fromStdin();
+
+    ~InputSource();
+
+    InputSource(const InputSource &) = delete;
+    InputSource &operator=(const InputSource &) = delete;
+
+    int get()
+    {
+
+        if(mPos != mEnd)
+            return static_cast<unsigned char>(*mPos++);
+
+        return underflow();
+
+    }
+
+    void tie(OutputSink *output) { mTie = output; }
+    void watch(Watchdog *watchdog) { mWatchdog = watchdog; }
+
+private:
+
+    InputSource();
+
+    int underflow();
+
+    const char *mPos;
+    const char *mEnd;
+
+    std::unique_ptr<MappedFile> mMapping;
+    std::string mText;
+    std::vector <char> mBuffer;
+
+    // Descriptor to refill mBuffer from, -1 when the input is fully in memory
+    int mFd;
+    bool mOwnsFd;
+
+    OutputSink *mTie;
+    Watchdog *mWatchdog;
+
+};
+
+#endif
@@ -1,677 +1,2483 @@
 #include "Interpreter.hpp"
+#include "FindZero.hpp"
+#include "Debugger.hpp"
+#include "LoopCompiler.hpp"
+#include "Watchdog.hpp"
 #include <fstream>
 #include <iostream>
 #include <stack>
 #include <map>
+#include <algorithm>
 #include <utility>
 #include <stdexcept>
 #include <cassert>
+#include <cstdint>
 #include <iomanip>
+#include <chrono>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Labels as values are a GNU extension (also supported by clang)
+#if defined(__GNUC__)
+#define BF_COMPUTED_GOTO
+#endif
+
+#if defined(__GNUC__)
+#define BF_NOINLINE __attribute__((noinline))
+#else
+#define BF_NOINLINE
+#endif
+
+#if defined(BF_COMPUTED_GOTO)
+const Interpreter::Engine Interpreter::defaultEngine = Engine::threaded;
+#else
+const Interpreter::Engine Interpreter::defaultEngine = Engine::switchDispatch;
+#endif
+
+namespace
+{
+
+const std::size_t commandBlockSize = 16;
+// Taken back edges after which a tiered run compiles the loop
+const std::uint32_t hotLoopThreshold = 1 << 12;
+
+// Takes steps out of the budget of a limited engine, the watchdog refills it when it runs out
+inline void spend(std::uint64_t &budget,std::uint64_t steps,Watchdog &watchdog)
+{
+
+    if(steps <= budget)
+        budget -= steps;
+
+    else
+        budget = watchdog.refill(steps - budget);
+
+}
+
+// Back edges a loop takes in iterations turns, what a folded loop spends
+inline std::uint64_t foldedBackEdges(std::uint64_t iterations)
+{
+
+    return iterations ? iterations - 1 : 0;
+
+}
+
+unsigned countTrailingZeros(std::uint32_t mask)
+{
+
+    #if defined(__GNUC__)
+
+    return __builtin_ctz(mask);
+
+    #else
+
+    unsigned count = 0;
+
+    while(!(mask & 1))
+    {
+
+        mask >>= 1;
+        ++count;
+
+    }
+
+    return count;
+
+    #endif
+
+}
+
+/*
+
+Bit i is set when block[i] is a command character ('#' counts only in debug mode).
+At most commandBlockSize bytes and never more than size bytes are examined.
+
+*/
+std::uint32_t commandMask(const char *block,std::size_t size,bool debugMode)
+{
+
+    #if defined(__SSE2__)
+
+    if(size >= commandBlockSize)
+    {
+
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+
+        // '+' ',' '-' '.' are consecutive, shift them to the bottom of the signed range
+        __m128i shifted = _mm_add_epi8(bytes,_mm_set1_epi8(static_cast<char>(0x80 - '+')));
+        __m128i commands = _mm_cmplt_epi8(shifted,_mm_set1_epi8(static_cast<char>(0x80 + 4)));
+
+        commands = _mm_or_si128(commands,_mm_cmpeq_epi8(bytes,_mm_set1_epi8('<')));
+        commands = _mm_or_si128(commands,_mm_cmpeq_epi8(bytes,_mm_set1_epi8('>')));
+        commands = _mm_or_si128(commands,_mm_cmpeq_epi8(bytes,_mm_set1_epi8('[')));
+        commands = _mm_or_si128(commands,_mm_cmpeq_epi8(bytes,_mm_set1_epi8(']')));
+
+        // Without debug mode compare against a character that already matches
+        commands = _mm_or_si128(commands,_mm_cmpeq_epi8(bytes,_mm_set1_epi8(debugMode ? '#' : '+')));
+
+        return _mm_movemask_epi8(commands);
+
+    }
+
+    #endif
+
+    std::uint32_t mask = 0;
+
+    if(size > commandBlockSize)
+        size = commandBlockSize;
+
+    for(std::size_t i = 0; i < size; ++i)
+        switch(block[i])
+        {
+
+        case '+': case '-': case '>': case '<':
+        case '[': case ']': case '.': case ',':
+
+            mask |= 1u << i;
+
+            break;
+
+        case '#':
+
+            if(debugMode)
+                mask |= 1u << i;
+
+            break;
+
+        default:
+            break;
+
+        }
+
+    return mask;
+
+}
+
+/*
+
+Upper bound of the instructions parseFile creates. Every run of '+' and '-' or of '<' and '>'
+becomes at most one instruction, every other command exactly one, and the program gets an OPend.
+Reserving this much keeps the parsed code from reallocating while it grows.
+
+*/
+std::size_t instructionBound(const char *source,std::size_t size,bool debugMode)
+{
+
+    std::size_t count = 1;
+    int previousRun = 0;
+
+    for(std::size_t block = 0; block < size; block += commandBlockSize)
+    for(std::uint32_t mask = commandMask(source + block,size - block,debugMode); mask; mask &= mask - 1)
+    {
+
+        const char ch = source[block + countTrailingZeros(mask)];
+        const int run = (ch == '+' || ch == '-') ? 1 : (ch == '<' || ch == '>') ? 2 : 0;
+
+        count += !run || run != previousRun;
+        previousRun = run;
+
+    }
+
+    return count;
+
+}
+
+
+/*
+
+Affine combination of cell values, keyed by offset. Arithmetic wraps modulo 2^64,
+which agrees with every narrower cell width.
+
+*/
+struct LinearForm
+{
+
+    std::map <std::int32_t,std::uint64_t> coefficients;
+    std::uint64_t constant;
+
+    LinearForm():constant(0){}
+
+    static LinearForm cell(std::int32_t offset)
+    {
+
+        LinearForm form;
+        form.coefficients[offset] = 1;
+
+        return form;
+
+    }
+
+    // this += other * factor
+    void add(const LinearForm &other,std::uint64_t factor)
+    {
+
+        for(const auto &term : other.coefficients)
+            if(!(coefficients[term.first] += term.second * factor))
+                coefficients.erase(term.first);
+
+        constant += other.constant * factor;
+
+    }
+
+    bool zero() const { return coefficients.empty() && !constant; }
+
+};
+
+// Cell values as forms of the values some time before
+using LinearState = std::map <std::int32_t,LinearForm>;
+
+LinearForm stateValue(const LinearState &state,std::int32_t offset)
+{
+
+    auto iter = state.find(offset);
+
+    return iter != state.end() ? iter->second : LinearForm::cell(offset);
+
+}
+
+std::uint64_t wrap(std::int64_t value)
+{
+
+    return static_cast<std::uint64_t>(value);
+
+}
+
+bool fitsParameter(std::uint64_t value)
+{
+
+    std::int64_t signedValue = static_cast<std::int64_t>(value);
+
+    return signedValue >= INT32_MIN && signedValue <= INT32_MAX;
+
+}
+
+// Fits a half of a pair packed by packPair
+bool fitsHalf(std::int64_t value)
+{
+
+    return value >= INT16_MIN && value <= INT16_MAX;
+
+}
+
+/*
+
+Inserts parts of tails into items, everything moves once. Every insertion is the index in
+front of which its part goes and where in tails the part begins, the part ends where the
+next one begins. Insertions are in ascending order.
+
+*/
+template <typename Item>
+void insertParts(std::vector <Item> &items,const std::vector <Item> &tails,
+                 const std::vector <std::pair<std::size_t,std::size_t>> &insertions)
+{
+
+    std::size_t end = items.size();
+    std::size_t tailEnd = tails.size();
+
+    items.resize(items.size() + tails.size());
+
+    auto out = items.end();
+
+    for(auto insertion = insertions.rbegin(); insertion != insertions.rend(); ++insertion)
+    {
+
+        out = std::move_backward(items.begin() + insertion->first,items.begin() + end,out);
+        out = std::copy_backward(tails.begin() + insertion->second,tails.begin() + tailEnd,out);
+        end = insertion->first;
+        tailEnd = insertion->second;
+
+    }
+
+}
+
+}
+
+
+const char *Interpreter::opcodeName(Opcode opcode)
+{
+
+    switch(opcode)
+    {
+
+    case OPeditVal:
+
+        return "editVal";
+
+    case OPmovePtr:
+
+        return "movePtr";
+
+    case OPjumpOnZero:
+
+        return "jumpOnZero";
+
+    case OPjumpOnNonZero:
+
+        return "jumpOnNonZero";
+
+    case OPmulAdd:
+
+        return "mulAdd";
+
+    case OPmulAddZero:
+
+        return "mulAddZero";
+
+    case OPsetZero:
+
+        return "setZero";
+
+    case OPfindZero:
+
+        return "findZero";
+
+    case OPtripCount:
+
+        return "tripCount";
+
+    case OPproduct:
+
+        return "product";
+
+    case OPwrite:
+
+        return "write";
+
+    case OPloadTape:
+
+        return "loadTape";
+
+    case OPprint:
+
+        return "print";
+
+    case OPread:
+
+        return "read";
+
+    case OPdebug:
+
+        return "debug";
+
+    case OPend:
+
+        return "end";
+
+    case OPmulAddWide:
+
+        return "mulAddWide";
+
+    case OPmulAddZeroWide:
+
+        return "mulAddZeroWide";
+
+    }
+
+    return "";
+
+}
+
 
 #if !defined(NDEBUG)
 
-void Interpreter::dumpCode(const Code &code,const std::string &filename)
+void Interpreter::dumpCode(const std::string &filename) const
+{
+
+    std::ofstream file(filename.c_str());
+    assert(file.is_open());
+
+    const int addressW = 12;
+    const int opcodeW = 15;
+    const int pW = 8;
+
+    file << "Size: " << mCode.size() << "\n\n";
+    file << std::setw(addressW) << std::left << "address" << std::setw(opcodeW) << "opcode" << std::right
+         << std::setw(pW) << "p1" << std::setw(pW) << "p2" << std::setw(pW) << "p3" << std::setw(pW) << "p4" << std::setw(pW) << "pos";
+
+    file << "\n";
+
+    for(std::size_t i = 0; i < mCode.size(); i++)
+    {
+
+        Instruction instr = mCode[i];
+
+        file << "0x" << std::right << std::setw(8) << std::setfill('0')
+             << std::hex << std::uppercase << i << ": ";
+
+        file << std::dec << std::left << std::setw(opcodeW) << std::setfill(' ');
+
+        file << opcodeName(instr.opcode);
+
+        Opcode op = instr.opcode;
+
+        if(op == OPjumpOnZero || op == OPjumpOnNonZero)
+            file << std::hex;
+
+        file << std::right << std::setw(pW) << instr.parameter << std::dec << std::setw(pW) << instr.parameter2
+             << std::setw(pW) << instr.parameter3 << std::setw(pW) << instr.parameter4
+             << std::setw(pW) << mSourcePos[i] << "\n";
+
+    }
+
+}
+
+
+void Interpreter::dumpBlocks(const std::vector <std::pair<std::size_t,std::size_t>> &blocks,const std::string &filename)
+{
+
+    std::ofstream file(filename.c_str());
+    assert(file.is_open());
+
+    const int columnW = 10;
+    std::size_t before = 0;
+    std::size_t after = 0;
+
+    file << "Blocks: " << blocks.size() << "\n\n";
+    file << std::setw(columnW) << "block" << std::setw(columnW) << "before" << std::setw(columnW) << "after" << "\n";
+
+    for(std::size_t i = 0; i < blocks.size(); i++)
+    {
+
+        file << std::setw(columnW) << i << std::setw(columnW) << blocks[i].first
+             << std::setw(columnW) << blocks[i].second << "\n";
+
+        before += blocks[i].first;
+        after += blocks[i].second;
+
+    }
+
+    file << "\n" << std::setw(columnW) << "total" << std::setw(columnW) << before << std::setw(columnW) << after << "\n";
+
+}
+
+#endif
+
+
+/*
+
+Everything a run needs that does not depend on its input. The JIT translates mCode when
+it runs, the other engines run the lowered code and only the profile report looks at mCode
+after lowering.
+
+*/
+void Interpreter::compile(const char *source,std::size_t size,const Options &options)
+{
+
+    if(!validCellBits(options.cellBits))
+        throw std::runtime_error("Invalid cell size " + std::to_string(options.cellBits));
+
+    typedef std::chrono::steady_clock Clock;
+
+    const auto seconds = [](Clock::time_point start)
+    {
+
+        return std::chrono::duration<double>(Clock::now() - start).count();
+
+    };
+
+    init(options);
+    mPhaseTimes = PhaseTimes();
+
+    Clock::time_point start = Clock::now();
+    const bool cached = !options.cacheDir.empty() && loadCached(source,size);
+
+    if(!cached)
+        parseFile(source,size,options.debugMode);
+
+    mPhaseTimes.parse = seconds(start);
+
+    start = Clock::now();
+
+    if(!cached)
+    {
+
+        performOptimizations();
+
+        if(!options.cacheDir.empty())
+            storeCached(source,size);
+
+    }
+
+    mGuardCells = maxAccessDistance();
+
+    if(options.profile)
+        mSource.assign(source,size);
+
+    if(options.engine == Engine::jit && !options.profile)
+    {
+
+        switch(options.cellBits)
+        {
+
+        case 8:
+
+            compileJit<std::uint8_t>();
+
+            break;
+
+        case 16:
+
+            compileJit<std::uint16_t>();
+
+            break;
+
+        case 32:
+
+            compileJit<std::uint32_t>();
+
+            break;
+
+        case 64:
+
+            compileJit<std::uint64_t>();
+
+            break;
+
+        }
+
+        Code().swap(mCode);
+        SourcePositions().swap(mSourcePos);
+
+    }
+    else
+    {
+
+        lowerCode();
+
+        // Profile reports and tiered runs still look up the instructions
+        if(!options.profile && options.engine != Engine::tiered)
+        {
+
+            Code().swap(mCode);
+            SourcePositions().swap(mSourcePos);
+            std::vector <std::int32_t>().swap(mLoweredIndex);
+
+        }
+
+    }
+
+    mPhaseTimes.optimize = seconds(start);
+
+}
+
+
+bool Interpreter::validCellBits(unsigned cellBits)
+{
+
+    return cellBits == 8 || cellBits == 16 || cellBits == 32 || cellBits == 64;
+
+}
+
+
+template <typename CellType>
+void Interpreter::execute(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const
+{
+
+    // Arms the tape in its own frame
+    if(mOptions.engine == Engine::jit && !mOptions.profile)
+    {
+
+        executeCodeJit<CellType>(input,output,tape,state);
+        return;
+
+    }
+
+    /*
+
+    Faults on the guard pages jump back here. The engines are not inlined into
+    this function, sigsetjmp would keep their state out of registers.
+
+    */
+    if(sigsetjmp(tape.arm(),1))
+    {
+
+        // The watchdog stops a run the same way
+        if(state.watchdog && state.watchdog->exceeded())
+            throw LimitExceeded(state.watchdog->exceeded());
+
+        throw std::runtime_error("Tape overflow");
+
+    }
+
+    // Runs without limits do not carry a budget at all
+    if(state.watchdog)
+        executeEngine<CellType,true>(input,output,tape,state);
+
+    else
+        executeEngine<CellType,false>(input,output,tape,state);
+
+}
+
+
+template <typename CellType,bool Limited>
+void Interpreter::executeEngine(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const
+{
+
+    // Counting in the switch engine costs one increment per instruction
+    if(mOptions.profile)
+    {
+
+        state.counts.assign(mCompactCode.size(),0);
+        executeCode<CellType,true,false,Limited>(input,output,tape,state);
+        return;
+
+    }
+
+    // Back edges are only counted by the switch engine
+    if(mOptions.engine == Engine::tiered)
+    {
+
+        state.backEdges.assign(mCompactCode.size(),0);
+        state.loopCompiler = std::make_shared<LoopCompiler>(*this,input,output,tape,state.debugger,state.watchdog);
+        executeCode<CellType,false,true,Limited>(input,output,tape,state);
+        state.loopCompiler.reset();
+        return;
+
+    }
+
+    #if defined(BF_COMPUTED_GOTO)
+
+    if(mOptions.engine == Engine::threaded)
+    {
+
+        executeCodeThreaded<CellType,Limited>(input,output,tape,state);
+        return;
+
+    }
+
+    #endif
+
+    // Switch dispatch is used as fallback when threaded code is not supported
+    executeCode<CellType,false,false,Limited>(input,output,tape,state);
+
+}
+
+template void Interpreter::execute<std::uint8_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+template void Interpreter::execute<std::uint16_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+template void Interpreter::execute<std::uint32_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+template void Interpreter::execute<std::uint64_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+
+
+/*
+
+Largest number of cells between two consecutive cell accesses.
+Guard pages at least this large guarantee that an overrun touches a guard page
+before it can reach memory outside the tape.
+
+Every block starts at a cell the previous block ended on (or at the origin), so all
+accesses of a block lie within its reach from there and two of them are at most twice
+the reach apart.
+
+*/
+std::size_t Interpreter::maxAccessDistance() const
+{
+
+    std::size_t reach = 0;
+    // Pointer relative to the block entry, only unoptimized code moves it inside a block
+    std::int64_t pointer = 0;
+
+    auto access = [&](std::int64_t position)
+    {
+
+        std::size_t distance = static_cast<std::size_t>(position < 0 ? -position : position);
+
+        if(distance > reach)
+            reach = distance;
+
+    };
+
+    for(const auto &instr : mCode)
+    {
+
+        if(endsBlock(instr.opcode))
+        {
+
+            access(pointer + instr.parameter3);
+
+            // Every step of the scan is an access
+            if(instr.opcode == OPfindZero)
+                access(instr.parameter);
+
+            pointer = 0;
+
+            continue;
+
+        }
+
+        switch(instr.opcode)
+        {
+
+        case OPmovePtr:
+
+            pointer += instr.parameter;
+
+            break;
+
+        case OPproduct:
+
+            access(pointer + instr.parameter3);
+            access(pointer + instr.parameter3 + lowHalf(instr.parameter));
+            access(pointer + instr.parameter3 + highHalf(instr.parameter));
+
+            break;
+
+        case OPmulAdd:
+        case OPmulAddZero:
+
+            access(pointer + instr.parameter3);
+            access(pointer + instr.parameter3 + instr.parameter);
+
+            break;
+
+        case OPloadTape:
+
+            access(pointer + instr.parameter3);
+            access(pointer + instr.parameter3 + static_cast<std::int64_t>(mPrefixTape.size()) - 1);
+
+            break;
+
+        default:
+
+            access(pointer + instr.parameter3);
+
+            break;
+
+        }
+
+    }
+
+    return 2 * reach + 1;
+
+}
+
+
+/*
+
+Except parsing this function does:
+- Optimizes series of "+" and "-"
+- Check for loops we can optimize
+
+*/
+void Interpreter::parseFile(const char *source,std::size_t sourceSize,bool debugMode)
+{
+
+    decltype(Instruction::parameter) codePos = 0;
+    LoopStack loopStack;
+
+    //Variables related to loop optimizations
+    int relativePointer = 0;
+    int loopCounter = 0;
+    bool hasPrintRead = false;
+    bool recentPop = false;
+
+    // Breakpoints stop the run like '#' does, at the first command they reach
+    auto breakpoint = mOptions.breakpoints.cbegin();
+    const auto breakpointsEnd = debugMode ? mOptions.breakpoints.cend() : breakpoint;
+
+    mCode.reserve(instructionBound(source,sourceSize,debugMode) + (debugMode ? mOptions.breakpoints.size() : 0));
+
+    const bool keepPositions = keepSourcePositions();
+
+    if(keepPositions)
+        mSourcePos.reserve(mCode.capacity());
+
+    // Only commands reach the switch, comments are skipped a block at a time
+    for(std::size_t block = 0; block < sourceSize; block += commandBlockSize)
+    for(std::uint32_t mask = commandMask(source + block,sourceSize - block,debugMode); mask; mask &= mask - 1)
+    {
+
+        codePos = block + countTrailingZeros(mask);
+        char ch = source[codePos];
+
+        if(breakpoint != breakpointsEnd && *breakpoint <= static_cast<std::size_t>(codePos))
+        {
+
+            // A '#' stops there already
+            if(ch != '#')
+            {
+
+                mCode.push_back({OPdebug,codePos});
+                hasPrintRead = true;
+
+            }
+
+            while(breakpoint != breakpointsEnd && *breakpoint <= static_cast<std::size_t>(codePos))
+                ++breakpoint;
+
+        }
+
+        switch(ch)
+        {
+
+        case '+':
+        case '-':
+        case '>':
+        case '<':
+
+            {
+
+                int increment = (ch == '+' || ch == '>') ? 1 : -1;
+                Opcode op = (ch == '+' || ch == '-') ? OPeditVal : OPmovePtr;
+
+                if(op == OPeditVal)
+                    loopCounter += increment * (relativePointer == 0);
+
+                else
+                    relativePointer += increment;
+
+                if(mCode.empty() || mCode.back().opcode != op)
+                {
+
+                    mCode.push_back({op,increment});
+
+                }
+
+                else if((mCode.back().parameter += increment) == 0)
+                    mCode.pop_back();
+
+            }
+
+            break;
+
+        case '[':
+
+            mCode.push_back(Instruction(OPjumpOnZero));
+            loopStack.push(mCode.size() - 1);
+
+            //Loop optimization related code
+            relativePointer = 0;
+            loopCounter = 0;
+            hasPrintRead = recentPop = false;
+
+            break;
+
+        case ']':
+
+            if(loopStack.empty())
+                throw std::runtime_error("Unbalanced brackets");
+
+            else
+            {
+                //Loop optimization related code
+                if(!recentPop && loopCounter != 0 && relativePointer == 0 && !hasPrintRead)
+                    mCode[loopStack.top()].parameter2 = 1;
+
+                mCode.push_back({OPjumpOnNonZero,loopStack.top()});
+                mCode[loopStack.top()].parameter = mCode.size() - 1;
+                loopStack.pop();
+                recentPop = true;
+
+            }
+
+
+            break;
+
+        case '.':
+
+            mCode.push_back(Instruction(OPprint));
+            hasPrintRead = true;
+
+            break;
+
+        case ',':
+
+            mCode.push_back(Instruction(OPread));
+            hasPrintRead = true;
+
+            break;
+
+        case '#':
+
+            // A stop inside a loop keeps the loop from being folded
+            if(debugMode)
+            {
+
+                mCode.push_back({OPdebug,codePos});
+                hasPrintRead = true;
+
+            }
+
+            break;
+
+        default:
+            break;
+
+        }
+
+        // What the command added is made from it, a merged command keeps the position of the first
+        if(keepPositions)
+            mSourcePos.resize(mCode.size(),codePos);
+
+    }
+
+    if(!loopStack.empty())
+        throw std::runtime_error("Unbalanced brackets");
+
+    if(breakpoint != breakpointsEnd)
+    {
+
+        mCode.push_back({OPdebug,static_cast<decltype(Instruction::parameter)>(sourceSize)});
+
+    }
+
+    mCode.push_back(Instruction(OPend));
+
+    if(keepPositions)
+        mSourcePos.resize(mCode.size(),sourceSize);
+
+}
+
+
+template <typename CellType,bool Profiling,bool Tiered,bool Limited>
+BF_NOINLINE void Interpreter::executeCode(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const
+{
+
+    int stdinChar;
+    const CompactInstruction *code = &mCompactCode.front();
+    const CompactInstruction *toExecute = code;
+    std::uint64_t *counts = state.counts.data();
+    std::uint32_t *backEdges = state.backEdges.data();
+    LoopCompiler *compiler = state.loopCompiler.get();
+    // Steps left before the watchdog has to be asked for more
+    std::uint64_t budget = Limited ? state.watchdog->refill(0) : 0;
+
+    CellType *cellArray = tape.origin<CellType>();
+    const FindZeroFunction<CellType> scanForZero = findZeroFunction<CellType>();
+    std::ptrdiff_t dataPtr = 0;
+
+    while(true)
+    {
+
+        if(Profiling)
+            ++counts[toExecute - code];
+
+        // Cell addressed by the instruction, instructions ending a block also move the pointer there
+        CellType *cell = cellArray + (dataPtr + toExecute->move);
+        *cell += toExecute->edit;
+
+        switch(toExecute->opcode)
+        {
+
+        case OPeditVal:
+
+            *cell += toExecute->operand;
+
+            break;
+
+        case OPmovePtr:
+
+            dataPtr += toExecute->operand;
+
+            break;
+
+        case OPjumpOnZero:
+
+            dataPtr += toExecute->move;
+
+            assert(toExecute->operand >= 0);
+            assert(static_cast<std::size_t>(toExecute->operand) < mCompactCode.size());
+
+            if(!*cell)
+                toExecute = &code[toExecute->operand];
+
+            // Entering a loop that is already compiled runs all of it natively
+            else if(Tiered && backEdges[toExecute->operand] >= hotLoopThreshold)
+            {
+
+                if(LoopFunction loop = compiler->entry(toExecute->operand))
+                {
+
+                    dataPtr = static_cast<CellType *>(compiler->call(loop,cell,budget)) - cellArray;
+                    toExecute = &code[toExecute->operand];
+
+                }
+
+            }
+
+            break;
+
+        case OPjumpOnNonZero:
+
+            dataPtr += toExecute->move;
+
+            assert(toExecute->operand >= 0);
+            assert(static_cast<std::size_t>(toExecute->operand) < mCompactCode.size());
+
+            if(*cell)
+            {
+
+                if(Limited)
+                    spend(budget,1,*state.watchdog);
+
+                // A hot loop goes to the compiler, the native code takes over at a later back edge
+                if(Tiered && ++backEdges[toExecute - code] >= hotLoopThreshold)
+                {
+
+                    if(LoopFunction loop = compiler->entry(toExecute - code))
+                    {
+
+                        dataPtr = static_cast<CellType *>(compiler->call(loop,cell,budget)) - cellArray;
+                        break;
+
+                    }
+
+                    if(backEdges[toExecute - code] == hotLoopThreshold)
+                        compiler->submit(toExecute - code);
+
+                }
+
+                toExecute = &code[toExecute->operand];
+
+            }
+
+            break;
+
+
+        case OPmulAdd:
+
+            /*If statement used to prevent out of range indexing when *cell == 0
+              and cell + offset is outside the tape */
+            if(*cell)
+                cell[lowHalf(toExecute->operand)] += multiply(*cell,highHalf(toExecute->operand));
+
+            break;
+
+        case OPmulAddZero:
+
+            if(*cell)
+                cell[lowHalf(toExecute->operand)] += multiply(*cell,highHalf(toExecute->operand));
+
+            *cell = 0;
+
+            break;
+
+        case OPmulAddWide:
+
+            if(*cell)
+                cell[toExecute->operand] += multiply(*cell,toExecute[1].operand);
+
+            ++toExecute;
+
+            break;
+
+        case OPmulAddZeroWide:
+
+            if(*cell)
+                cell[toExecute->operand] += multiply(*cell,toExecute[1].operand);
+
+            *cell = 0;
+            ++toExecute;
+
+            break;
+
+        case OPsetZero:
+
+            *cell = 0;
+
+            break;
+
+        case OPfindZero:
+
+            dataPtr += toExecute->move;
+
+            if(*cell)
+            {
+
+                CellType *found = scanForZero(cell,toExecute->operand);
+
+                if(Limited)
+                    spend(budget,foldedBackEdges((found - cell) / toExecute->operand),*state.watchdog);
+
+                dataPtr = found - cellArray;
+
+            }
+
+            break;
+
+        case OPtripCount:
+
+            // The loop never ends, neither does this instruction, every turn is one of its iterations
+            if(!tripCount(*cell,toExecute->operand))
+            {
+
+                if(Limited)
+                    spend(budget,1,*state.watchdog);
+
+                --toExecute;
+
+            }
+
+            else if(Limited)
+                spend(budget,foldedBackEdges(*cell),*state.watchdog);
+
+            break;
+
+        case OPproduct:
+
+            if(*cell)
+                cell[toExecute->operand] += multiply(multiplyCells(*cell,cell[toExecute[2].operand]),toExecute[1].operand);
+
+            toExecute += 2;
+
+            break;
+
+        case OPwrite:
+
+            output.write(mPrefixOutput.data(),mPrefixOutput.size());
+
+            break;
+
+        case OPloadTape:
+
+            loadPrefixTape(cell);
+
+            break;
+
+        case OPprint:
+
+            output.put(static_cast<char>(*cell));
+
+            break;
+
+        case OPread:
+
+            stdinChar = input.get();
+
+            if(stdinChar != InputSource::eof)
+                *cell = stdinChar;
+
+            break;
+
+        case OPdebug:
+
+            state.debugger->stop(toExecute->operand,cell,cellArray,output);
+
+            break;
+
+        case OPend:
+
+            output.flush();
+            goto finish;
+
+
+        default:
+            break;
+
+        }
+
+        ++toExecute;
+
+    }
+
+finish:;
+
+}
+
+
+#if defined(BF_COMPUTED_GOTO)
+
+/*
+
+Same semantics as executeCode, but every instruction carries the address of its
+handler and every handler ends with its own indirect jump, so the branch predictor
+can learn the opcode sequences instead of sharing a single dispatch branch.
+
+*/
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+template <typename CellType,bool Limited>
+BF_NOINLINE void Interpreter::executeCodeThreaded(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const
+{
+
+    // Indexed by Opcode
+    static const void *const handlers[] =
+    {
+
+        &&editVal,
+        &&movePtr,
+        &&jumpOnZero,
+        &&jumpOnNonZero,
+        &&mulAdd,
+        &&mulAddZero,
+        &&setZero,
+        &&findZero,
+        &&tripCount,
+        &&product,
+        &&write,
+        &&loadTape,
+        &&print,
+        &&read,
+        &&debug,
+        &&end,
+        &&mulAddWide,
+        &&mulAddZeroWide
+
+    };
+
+    ThreadedCode &code = state.threadedCode;
+    code.clear();
+    code.reserve(mCompactCode.size());
+
+    for(const auto &instr : mCompactCode)
+        code.push_back({handlers[instr.opcode],instr});
+
+
+    int stdinChar;
+    const ThreadedInstruction *toExecute = &code.front();
+
+    CellType *cellArray = tape.origin<CellType>();
+    const FindZeroFunction<CellType> scanForZero = findZeroFunction<CellType>();
+    std::ptrdiff_t dataPtr = 0;
+    // Steps left before the watchdog has to be asked for more
+    std::uint64_t budget = Limited ? state.watchdog->refill(0) : 0;
+
+    CellType *cell;
+
+    // Instructions ending a block move the pointer to the cell themselves
+    #define BF_PROLOGUE() \
+        cell = cellArray + (dataPtr + toExecute->instr.move); \
+        *cell += toExecute->instr.edit
+
+    #define BF_DISPATCH() \
+        do \
+        { \
+            ++toExecute; \
+            BF_PROLOGUE(); \
+            goto *toExecute->handler; \
+        } while(false)
+
+    BF_PROLOGUE();
+    goto *toExecute->handler;
+
+editVal:
+
+    *cell += toExecute->instr.operand;
+    BF_DISPATCH();
+
+movePtr:
+
+    dataPtr += toExecute->instr.operand;
+    BF_DISPATCH();
+
+jumpOnZero:
+
+    dataPtr += toExecute->instr.move;
+
+    if(!*cell)
+        toExecute = &code[toExecute->instr.operand];
+
+    BF_DISPATCH();
+
+jumpOnNonZero:
+
+    dataPtr += toExecute->instr.move;
+
+    if(*cell)
+    {
+
+        if(Limited)
+            spend(budget,1,*state.watchdog);
+
+        toExecute = &code[toExecute->instr.operand];
+
+    }
+
+    BF_DISPATCH();
+
+mulAdd:
+
+    if(*cell)
+        cell[lowHalf(toExecute->instr.operand)] += multiply(*cell,highHalf(toExecute->instr.operand));
+
+    BF_DISPATCH();
+
+mulAddZero:
+
+    if(*cell)
+        cell[lowHalf(toExecute->instr.operand)] += multiply(*cell,highHalf(toExecute->instr.operand));
+
+    *cell = 0;
+    BF_DISPATCH();
+
+mulAddWide:
+
+    if(*cell)
+        cell[toExecute->instr.operand] += multiply(*cell,toExecute[1].instr.operand);
+
+    ++toExecute;
+    BF_DISPATCH();
+
+mulAddZeroWide:
+
+    if(*cell)
+        cell[toExecute->instr.operand] += multiply(*cell,toExecute[1].instr.operand);
+
+    *cell = 0;
+    ++toExecute;
+    BF_DISPATCH();
+
+setZero:
+
+    *cell = 0;
+    BF_DISPATCH();
+
+findZero:
+
+    dataPtr += toExecute->instr.move;
+
+    if(*cell)
+    {
+
+        CellType *found = scanForZero(cell,toExecute->instr.operand);
+
+        if(Limited)
+            spend(budget,foldedBackEdges((found - cell) / toExecute->instr.operand),*state.watchdog);
+
+        dataPtr = found - cellArray;
+
+    }
+
+    BF_DISPATCH();
+
+tripCount:
+
+    if(!tripCount(*cell,toExecute->instr.operand))
+    {
+
+        if(Limited)
+            spend(budget,1,*state.watchdog);
+
+        --toExecute;
+
+    }
+
+    else if(Limited)
+        spend(budget,foldedBackEdges(*cell),*state.watchdog);
+
+    BF_DISPATCH();
+
+product:
+
+    if(*cell)
+        cell[toExecute->instr.operand] += multiply(multiplyCells(*cell,cell[toExecute[2].instr.operand]),toExecute[1].instr.operand);
+
+    toExecute += 2;
+    BF_DISPATCH();
+
+write:
+
+    output.write(mPrefixOutput.data(),mPrefixOutput.size());
+    BF_DISPATCH();
+
+loadTape:
+
+    loadPrefixTape(cell);
+    BF_DISPATCH();
+
+print:
+
+    output.put(static_cast<char>(*cell));
+    BF_DISPATCH();
+
+read:
+
+    stdinChar = input.get();
+
+    if(stdinChar != InputSource::eof)
+        *cell = stdinChar;
+
+    BF_DISPATCH();
+
+debug:
+
+    state.debugger->stop(toExecute->instr.operand,cell,cellArray,output);
+    BF_DISPATCH();
+
+end:
+
+    output.flush();
+
+    #undef BF_DISPATCH
+    #undef BF_PROLOGUE
+
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+void Interpreter::init(const Options &options)
+{
+
+    for(const auto &name : options.enabledPasses)
+        if(!validPass(name))
+            throw std::runtime_error("Unknown pass " + name);
+
+    for(const auto &name : options.disabledPasses)
+        if(!validPass(name))
+            throw std::runtime_error("Unknown pass " + name);
+
+    if(options.optLevel > maxOptLevel)
+        throw std::runtime_error("Invalid optimization level " + std::to_string(options.optLevel));
+
+    mOptions = options;
+    mPrefixOutput.clear();
+    mPrefixTape.clear();
+    mSource.clear();
+    mGuardCells = 0;
+    mCodeReused = !options.cacheDir.empty();
+
+}
+
+
+void Interpreter::optimizeLoops()
+{
+
+    CodeWriter optimizedCode(mCode,mSourcePos);
+    // Increment of every target of the scanned loop, reused for all of them
+    std::map <decltype(Instruction::parameter),decltype(Instruction::parameter)> mulAddOpcodes;
+    LoopStack loopStack;
+
+    Instruction currentInstr;
+    int relativePointer = 0;
+    decltype(Instruction::parameter) counterStep = 0;
+    // Instructions replacing a loop take the position of its '['
+    decltype(Instruction::parameter) loopPos = 0;
+    bool scanLoop = false;
+
+
+    for(std::size_t i = 0; i < mCode.size(); ++i)
+    {
+
+        currentInstr = mCode[i];
+        const std::int32_t sourcePos = optimizedCode.sourcePos(i);
+
+        if(!scanLoop)
+        {
+
+            if(currentInstr.opcode == OPjumpOnZero )
+            {
+
+                //Is this loop to optimize, if yes start scan
+                if(currentInstr.parameter2)
+                {
+
+                    scanLoop = true;
+                    loopPos = sourcePos;
+
+                }
+
+                else
+                {
+
+                    optimizedCode.push_back(currentInstr,sourcePos);
+                    loopStack.push(optimizedCode.size() - 1);
+
+                }
+
+            }
+
+            //Correct loop jumps
+            else if(currentInstr.opcode == OPjumpOnNonZero)
+            {
+
+                currentInstr.parameter = loopStack.top();
+                optimizedCode.push_back(currentInstr,sourcePos);
+                optimizedCode[loopStack.top()].parameter = optimizedCode.size() - 1;
+                loopStack.pop();
+
+            }
+            else
+                optimizedCode.push_back(currentInstr,sourcePos);
+
+        }
+
+        //Scan loop to optimize
+        else
+        {
+
+            switch(currentInstr.opcode)
+            {
+
+            case OPeditVal:
+
+                if(relativePointer != 0)
+                   mulAddOpcodes[relativePointer] += currentInstr.parameter;
+
+                else
+                    counterStep += currentInstr.parameter;
+
+                break;
+
+            case OPmovePtr:
+
+                relativePointer += currentInstr.parameter;
+
+                break;
+
+            case OPjumpOnNonZero:
+
+                {
+
+                    scanLoop = false;
+                    relativePointer = 0;
+
+                    // Targets whose increments cancel out are dropped
+                    for(auto iter = mulAddOpcodes.begin(); iter != mulAddOpcodes.end();)
+                        if(iter->second == 0)
+                            iter = mulAddOpcodes.erase(iter);
+
+                        else
+                            ++iter;
+
+                    /*
+
+                        Counters that do not step by -1 are first replaced with the number of
+                        iterations. An odd step always reaches zero, without targets that is
+                        all a setZero needs to know. With a step limit every loop gets one,
+                        the engines spend the back edges of the loop there.
+
+                    */
+                    if(mOptions.maxSteps || (counterStep != -1 && (counterStep % 2 == 0 || mulAddOpcodes.size())))
+                        optimizedCode.push_back({OPtripCount,counterStep},loopPos);
+
+                    counterStep = 0;
+
+                    /*
+
+                        Map stores elements in ascending order
+                        Based on that, this code [<->-<<+>>] is optimized to
+
+                        mulAdd -2, 1, 0
+                        mulAddZero -1, -1, 0
+
+                        Order does not affect code equivalence
+
+                    */
+
+                    // Zero for OPsetZero
+                    if(mulAddOpcodes.size())
+                        for(auto iter = mulAddOpcodes.cbegin(); iter != mulAddOpcodes.cend(); ++iter)
+                        {
+
+                            Instruction instr;
+
+                            instr.parameter = iter->first;
+                            instr.parameter2 = iter->second;
+
+                            if(iter != --mulAddOpcodes.cend())
+                                instr.opcode = OPmulAdd;
+
+                            else
+                                instr.opcode = OPmulAddZero;
+
+                            optimizedCode.push_back(instr,loopPos);
+
+                        }
+
+                    else
+                    {
+
+                        Instruction instr;
+                        instr.opcode = OPsetZero;
+                        optimizedCode.push_back(instr,loopPos);
+
+                    }
+
+                    mulAddOpcodes.clear();
+
+                }
+
+                break;
+
+            // Supress warnings
+            default:
+                break;
+
+
+            }
+
+        }
+
+    }
+
+    optimizedCode.finish();
+
+    #if !defined(NDEBUG)
+
+    dumpCode("OL1.txt");
+
+    #endif
+
+}
+
+
+/*
+
+Folds loops whose bodies are straight-line code and already folded inner loops, like the
+multiplication kernel [>[>+>+<<-]>[<+>-]<<-], which would otherwise take quadratic time.
+
+One iteration of such a body is an affine map of the cells. The first iteration is kept as it
+is, it may still have to bring temporaries into their steady state (above, the multiplicand
+is only restored by the copy back once the temporary starts out clear). If from then on every
+iteration adds the same amount to each cell, and that amount only depends on cells that no
+longer change, the remaining iterations become an OPmulAdd for the constant part and an
+OPproduct for every cell the amount depends on, both scaled by the remaining count.
+The folded code stays behind the loop's jumpOnZero, the counter is cleared at its end, so the
+jumpOnNonZero never branches.
+
+*/
+void Interpreter::foldNestedLoops()
 {
 
-    std::ofstream file(filename.c_str());
-    assert(file.is_open());
+    // The back edges of the inner loops in later iterations could not be spent
+    if(mOptions.maxSteps)
+        return;
 
-    const int addressW = 12;
-    const int opcodeW = 15;
-    const int pW = 8;
+    // Instructions appended to folded bodies, and for every folded loop the index of its
+    // jumpOnNonZero and where its part of tails begins
+    Code tails;
+    SourcePositions tailPositions;
+    std::vector <std::pair<std::size_t,std::size_t>> insertions;
+    // Last jumpOnZero with no jump after it, only innermost loops can fold
+    std::size_t innermost = mCode.size();
 
-    file << "Size: " << code.size() << "\n\n";
-    file << std::setw(addressW) << std::left << "address" << std::setw(opcodeW) << "opcode" << std::right
-         << std::setw(pW) << "p1" << std::setw(pW) << "p2" << std::setw(pW) << "p3" << std::setw(pW) << "p4";
+    for(std::size_t i = 0; i < mCode.size(); ++i)
+        if(mCode[i].opcode == OPjumpOnZero)
+            innermost = i;
 
-    file << "\n";
+        else if(mCode[i].opcode == OPjumpOnNonZero)
+        {
+
+            const std::size_t tailBegin = tails.size();
+
+            if(innermost < i && foldLoopBody(mCode.begin() + innermost + 1,mCode.begin() + i,tails))
+            {
 
-    for(std::size_t i = 0; i < code.size(); i++)
+                if(mOptions.verifyFolds)
+                {
+
+                    Code body(mCode.begin() + innermost + 1,mCode.begin() + i);
+                    Code folded(body);
+                    folded.insert(folded.end(),tails.begin() + tailBegin,tails.end());
+
+                    // Fold checks keep the positions
+                    if(!verifyFold(body,folded))
+                        throw std::runtime_error("Wrong fold of the loop at source position " +
+                                                 std::to_string(mSourcePos[innermost]));
+
+                }
+
+                // What follows the peeled iteration replaces the loop
+                if(!mSourcePos.empty())
+                    tailPositions.resize(tails.size(),mSourcePos[innermost]);
+
+                insertions.push_back({i,tailBegin});
+
+            }
+
+            innermost = mCode.size();
+
+        }
+
+    if(!tails.empty())
     {
 
-        Instruction instr = code[i];
+        // The tails go in front of their loop's jumpOnNonZero
+        insertParts(mCode,tails,insertions);
 
-        file << "0x" << std::right << std::setw(8) << std::setfill('0')
-             << std::hex << std::uppercase << i << ": ";
+        if(!mSourcePos.empty())
+            insertParts(mSourcePos,tailPositions,insertions);
 
-        file << std::dec << std::left << std::setw(opcodeW) << std::setfill(' ');
+        LoopStack loopStack;
 
-        switch(instr.opcode)
-        {
+        for(std::size_t i = 0; i < mCode.size(); ++i)
+            if(mCode[i].opcode == OPjumpOnZero)
+                loopStack.push(i);
 
-        case OPeditVal:
+            else if(mCode[i].opcode == OPjumpOnNonZero)
+            {
 
-            file << "editVal";
+                mCode[i].parameter = loopStack.top();
+                mCode[loopStack.top()].parameter = i;
+                loopStack.pop();
 
-            break;
+            }
 
-        case OPmovePtr:
+    }
 
-            file << "movePtr";
+    #if !defined(NDEBUG)
 
-            break;
+    dumpCode("nested.txt");
 
-        case OPjumpOnZero:
+    #endif
 
-            file << "jumpOnZero";
+}
 
-            break;
 
-        case OPjumpOnNonZero:
+// Appends what follows the first iteration of the folded body to tail, returns false when the body is not foldable
+bool Interpreter::foldLoopBody(Code::const_iterator begin,Code::const_iterator end,Code &tail)
+{
 
-            file << "jumpOnNonZero";
+    // Cells after one iteration, in terms of the cells before it
+    LinearState next;
+    decltype(Instruction::parameter) pointer = 0;
 
-            break;
+    for(auto iter = begin; iter != end; ++iter)
+    {
 
-        case OPmulAdd:
+        const Instruction &instr = *iter;
+
+        switch(instr.opcode)
+        {
+
+        case OPmovePtr:
 
-            file << "mulAdd";
+            pointer += instr.parameter;
 
             break;
 
-        case OPmulAddZero:
+        case OPeditVal:
+
+            {
+
+                LinearForm form = stateValue(next,pointer);
+                form.constant += wrap(instr.parameter);
+                next[pointer] = form;
 
-            file << "mulAddZero";
+            }
 
             break;
 
         case OPsetZero:
 
-            file << "setZero";
+            next[pointer] = LinearForm();
 
             break;
 
-        case OPfindZero:
+        case OPmulAdd:
+        case OPmulAddZero:
 
-            file << "findZero";
+            {
 
-            break;
+                LinearForm target = stateValue(next,pointer + instr.parameter);
+                target.add(stateValue(next,pointer),wrap(instr.parameter2));
+                next[pointer + instr.parameter] = target;
 
-        case OPprint:
+                if(instr.opcode == OPmulAddZero)
+                    next[pointer] = LinearForm();
 
-            file << "print";
+            }
 
             break;
 
-        case OPread:
+        // Unfolded loops, scans, I/O
+        default:
 
-            file << "read";
+            return false;
 
-            break;
+        }
 
-        case OPdebug:
+    }
 
-            file << "debug";
+    if(pointer != 0)
+        return false;
 
-            break;
+    // The counter has to step by a constant, and nothing else may depend on it
+    LinearForm counter = stateValue(next,0);
+    const std::uint64_t step = counter.constant;
+    counter.constant = 0;
 
-        case OPend:
+    if(!step || !fitsParameter(step) || counter.coefficients != LinearForm::cell(0).coefficients)
+        return false;
 
-            file << "end";
+    for(const auto &cell : next)
+        if(cell.first != 0 && cell.second.coefficients.count(0))
+            return false;
 
-            break;
+    // Change of every cell during an iteration, in terms of the cells before it
+    LinearState change;
+
+    for(const auto &cell : next)
+        if(cell.first != 0)
+        {
+
+            LinearForm form = cell.second;
+            form.add(LinearForm::cell(cell.first),wrap(-1));
+
+            if(!form.zero())
+                change[cell.first] = form;
 
         }
 
-        Opcode op = instr.opcode;
+    // Change during the second iteration, in terms of the cells before the loop
+    LinearState steadyChange;
 
-        if(op == OPjumpOnZero || op == OPjumpOnNonZero)
-            file << std::hex;
+    for(const auto &cell : change)
+    {
 
-        file << std::right << std::setw(pW) << instr.parameter << std::dec << std::setw(pW) << instr.parameter2
-             << std::setw(pW) << instr.parameter3 << std::setw(pW) << instr.parameter4 << "\n";
+        LinearForm form;
+        form.constant = cell.second.constant;
 
-    }
+        for(const auto &term : cell.second.coefficients)
+            form.add(stateValue(next,term.first),term.second);
 
-}
+        if(!form.zero())
+            steadyChange[cell.first] = form;
 
-#endif
+    }
 
+    for(const auto &cell : change)
+    {
 
-void Interpreter::run(std::ifstream &sourceFile,std::istream &stdInput,std::size_t arraySize,bool debugMode)
-{
+        // The change must stay the same in every later iteration
+        LinearForm drift;
 
-    init(arraySize);
-    parseFile(sourceFile,debugMode);
+        for(const auto &term : cell.second.coefficients)
+        {
 
-    if(!debugMode)
-        performOptimizations();
+            auto iter = steadyChange.find(term.first);
 
-    executeCode(stdInput);
+            if(iter != steadyChange.end())
+                drift.add(iter->second,term.second);
 
-}
+        }
 
+        if(!drift.zero())
+            return false;
 
-/*
+        if(!steadyChange.count(cell.first))
+            continue;
 
-Except parsing this function does:
-- Optimizes series of "+" and "-"
-- Check for loops we can optimize
+        if(!fitsParameter(cell.second.constant))
+            return false;
 
-*/
-void Interpreter::parseFile(std::ifstream &sourceFile,bool debugMode)
-{
+        // Only cells that stay the same may be read, OPproduct packs both offsets in a parameter
+        for(const auto &term : cell.second.coefficients)
+            if(steadyChange.count(term.first) || !fitsParameter(term.second) || !fitsHalf(cell.first) || !fitsHalf(term.first))
+                return false;
 
-    decltype(Instruction::parameter) codePos = 0;
-    LoopStack loopStack;
+    }
 
-    //Variables related to loop optimizations
-    int relativePointer = 0;
-    int loopCounter = 0;
-    bool hasPrintRead = false;
-    bool recentPop = false;
+    // The counter becomes the number of remaining iterations
+    if(static_cast<std::int64_t>(step) != -1)
+        tail.push_back({OPtripCount,static_cast<decltype(Instruction::parameter)>(step)});
 
-    while(true)
+    for(const auto &cell : steadyChange)
     {
 
-    	int nextChar = sourceFile.get();
+        const LinearForm &form = change[cell.first];
 
-        if(nextChar == std::ifstream::traits_type::eof())
-            break;
+        if(form.constant)
+        {
 
-        char ch = static_cast<char>(nextChar);
+            Instruction instr(OPmulAdd,cell.first);
+            instr.parameter2 = static_cast<decltype(Instruction::parameter)>(form.constant);
+            tail.push_back(instr);
 
-        switch(ch)
+        }
+
+        for(const auto &term : form.coefficients)
         {
 
-        case '+':
-        case '-':
-        case '>':
-        case '<':
+            Instruction instr(OPproduct,packPair(cell.first,term.first));
+            instr.parameter2 = static_cast<decltype(Instruction::parameter)>(term.second);
+            tail.push_back(instr);
 
-            {
+        }
 
-                int increment = (ch == '+' || ch == '>') ? 1 : -1;
-                Opcode op = (ch == '+' || ch == '-') ? OPeditVal : OPmovePtr;
+    }
 
-                if(op == OPeditVal)
-                    loopCounter += increment * (relativePointer == 0);
+    tail.push_back(Instruction(OPsetZero));
 
-                else
-                    relativePointer += increment;
+    return true;
 
-                if(mCode.empty() || mCode.back().opcode != op)
-                    mCode.push_back({op,increment});
+}
 
-                else if((mCode.back().parameter += increment) == 0)
-                    mCode.pop_back();
 
-            }
+// Runs the loop and its folded form on the same pseudo-random tapes, false when the results differ
+bool Interpreter::verifyFold(const Code &body,const Code &folded)
+{
 
-            break;
+    using Cells = std::map <decltype(Instruction::parameter),std::uint64_t>;
 
-        case '[':
+    decltype(Instruction::parameter) step = -1;
 
-            mCode.push_back(Instruction(OPjumpOnZero));
-            loopStack.push(mCode.size() - 1);
+    for(const auto &instr : folded)
+        if(instr.opcode == OPtripCount)
+            step = instr.parameter;
 
-            //Loop optimization related code
-            relativePointer = 0;
-            loopCounter = 0;
-            hasPrintRead = recentPop = false;
+    for(std::uint64_t round = 0; round < 16; ++round)
+    {
 
-            break;
+        // splitmix64 of the offset, so both runs start from the same values
+        auto initial = [&](decltype(Instruction::parameter) offset)
+        {
 
-        case ']':
+            std::uint64_t value = round * 0x9E3779B97F4A7C15ull + static_cast<std::uint64_t>(offset);
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
 
-            if(loopStack.empty())
-                throw std::runtime_error("Unbalanced brackets");
+            return round % 4 == 0 ? value % 3 : value ^ (value >> 31);
 
-            else
+        };
+
+        auto cell = [&](Cells &cells,decltype(Instruction::parameter) offset) -> std::uint64_t &
+        {
+
+            auto iter = cells.find(offset);
+
+            if(iter == cells.end())
+                iter = cells.insert({offset,initial(offset)}).first;
+
+            return iter->second;
+
+        };
+
+        auto execute = [&](const Code &code,Cells &cells) -> bool
+        {
+
+            decltype(Instruction::parameter) pointer = 0;
+
+            for(const auto &instr : code)
             {
-                //Loop optimization related code
-                if(!recentPop && loopCounter == -1 && relativePointer == 0 && !hasPrintRead)
-                    mLoopsToOptimize.insert(loopStack.top());
 
-                mCode.push_back({OPjumpOnNonZero,loopStack.top()});
-                mCode[loopStack.top()].parameter = mCode.size() - 1;
-                loopStack.pop();
-                recentPop = true;
+                std::uint64_t &current = cell(cells,pointer);
+
+                switch(instr.opcode)
+                {
+
+                case OPmovePtr:
+
+                    pointer += instr.parameter;
+
+                    break;
+
+                case OPeditVal:
+
+                    current += wrap(instr.parameter);
+
+                    break;
 
-            }
+                case OPsetZero:
 
+                    current = 0;
 
-            break;
+                    break;
 
-        case '.':
+                case OPmulAdd:
+                case OPmulAddZero:
 
-            mCode.push_back(Instruction(OPprint));
-            hasPrintRead = true;
+                    cell(cells,pointer + instr.parameter) += current * wrap(instr.parameter2);
 
-            break;
+                    if(instr.opcode == OPmulAddZero)
+                        cell(cells,pointer) = 0;
 
-        case ',':
+                    break;
 
-            mCode.push_back(Instruction(OPread));
-            hasPrintRead = true;
+                case OPproduct:
 
-            break;
+                    cell(cells,pointer + lowHalf(instr.parameter)) += current * cell(cells,pointer + highHalf(instr.parameter)) * wrap(instr.parameter2);
 
-        case '#':
+                    break;
 
-            if(debugMode)
-                mCode.push_back({OPdebug,codePos});
+                case OPtripCount:
 
-            break;
+                    // The counter of a folded loop always reaches zero
+                    if(!tripCount(current,instr.parameter))
+                        return false;
 
-        default:
-            break;
+                    break;
 
-        }
+                default:
 
-        ++codePos;
+                    return false;
 
-    }
+                }
 
-    if(!loopStack.empty())
-        throw std::runtime_error("Unbalanced brackets");
+            }
 
-    mCode.push_back(Instruction(OPend));
+            return true;
 
-}
+        };
 
+        Cells loop;
+        Cells fold;
 
-void Interpreter::executeCode(std::istream &stdInput)
-{
+        // A counter the loop counts down to zero in a few iterations
+        cell(loop,0) = cell(fold,0) = wrap(-static_cast<std::int64_t>(step)) * (round % 5);
 
-    int stdinChar;
-    Instruction *code = &mCode.front();
-    Instruction *toExecute = code;
+        while(cell(loop,0))
+            if(!execute(body,loop))
+                return false;
 
-    CellType *cellArray = &mCellArray.front();
-    CellType dataPtr = 0;
+        if(cell(fold,0) && !execute(folded,fold))
+            return false;
 
-    while(true)
-    {
+        for(const auto &value : loop)
+            if(cell(fold,value.first) != value.second)
+                return false;
 
-        assert(dataPtr >= 0);
-        assert(dataPtr < mCellArray.size());
+        for(const auto &value : fold)
+            if(cell(loop,value.first) != value.second)
+                return false;
 
-        dataPtr += toExecute->parameter3;
-        cellArray[dataPtr] += toExecute->parameter4;
+    }
 
-        switch(toExecute->opcode)
-        {
+    return true;
 
-        case OPeditVal:
+}
 
-            cellArray[dataPtr] += toExecute->parameter;
 
-            break;
+/*
 
-        case OPmovePtr:
+Passes later in the list rely on the shape of the code the earlier ones leave behind
+(findZeroOptimize on pointer moves offsetBlocks removes, for one), so the order is fixed
+and only the set that runs changes. Each works on code any subset of the ones before
+it may have produced.
 
-            dataPtr += toExecute->parameter;
+*/
+const Interpreter::Pass Interpreter::passes[] =
+{
 
-            break;
+    {"loops",1,&Interpreter::optimizeLoops},
+    {"nested",2,&Interpreter::foldNestedLoops},
+    {"find-zero",1,&Interpreter::findZeroOptimize},
+    {"offsets",2,&Interpreter::offsetBlocks},
+    {"prefix",3,&Interpreter::partiallyEvaluate}
 
-        case OPjumpOnZero:
+};
 
-            assert(toExecute->parameter >= 0);
-            assert(static_cast<std::size_t>(toExecute->parameter) < mCellArray.size());
 
-            if(!cellArray[dataPtr])
-                toExecute = &code[toExecute->parameter];
+bool Interpreter::validPass(const std::string &name)
+{
 
-            break;
+    for(const auto &pass : passes)
+        if(name == pass.name)
+            return true;
 
-        case OPjumpOnNonZero:
+    return false;
 
-            assert(toExecute->parameter >= 0);
-            assert(static_cast<std::size_t>(toExecute->parameter) < mCellArray.size());
+}
 
-            if(cellArray[dataPtr])
-                toExecute = &code[toExecute->parameter];
 
-            break;
+std::string Interpreter::passNames()
+{
 
+    std::string names;
 
-        case OPmulAdd:
+    for(const auto &pass : passes)
+        names += (names.empty() ? "" : ", ") + std::string(pass.name);
 
-            /*If statement used to prevent out of range indexing when cellArray[dataPtr] == 0
-              and dataPtr + toExecute->parameter < 0 */
-            if(cellArray[dataPtr])
-                cellArray[dataPtr + toExecute->parameter] += cellArray[dataPtr] * toExecute->parameter2;
+    return names;
 
-            break;
+}
 
-        case OPmulAddZero:
 
-            if(cellArray[dataPtr])
-                cellArray[dataPtr + toExecute->parameter] += cellArray[dataPtr] * toExecute->parameter2;
+bool Interpreter::passEnabled(const Pass &pass) const
+{
 
-            cellArray[dataPtr] = 0;
+    if(mOptions.disabledPasses.count(pass.name))
+        return false;
 
-            break;
+    return mOptions.enabledPasses.count(pass.name) || pass.level <= mOptions.optLevel;
 
-        case OPsetZero:
+}
 
-            cellArray[dataPtr] = 0;
 
-            break;
+bool Interpreter::keepSourcePositions() const
+{
 
-        case OPfindZero:
+    #if defined(NDEBUG)
 
-            while(cellArray[dataPtr])
-                dataPtr += toExecute->parameter;
+    return mOptions.profile || mOptions.verifyFolds;
 
-            break;
+    #else
 
-        case OPprint:
+    return true;
+
+    #endif
 
-            std::cout << static_cast<char>(cellArray[dataPtr]) << std::flush;
+}
 
-            break;
 
-        case OPread:
+void Interpreter::performOptimizations()
+{
 
-            stdinChar = stdInput.get();
+    typedef std::chrono::steady_clock Clock;
 
-            if(stdinChar != std::ifstream::traits_type::eof())
-                cellArray[dataPtr] = stdinChar;
+    const int columnW = 14;
 
-            break;
+    if(mOptions.timePasses)
+        std::cerr << "\nPass timing\n" << std::setw(columnW) << "pass" << std::setw(columnW) << "time (ms)"
+                  << std::setw(columnW) << "before" << std::setw(columnW) << "after\n";
 
-        case OPdebug:
+    double total = 0;
 
-            std::cerr << "Position within the code: " << toExecute->parameter << "\n";
-            std::cerr << "Pointer value: " << dataPtr << "\n";
-            std::cerr << "Value at pointer: " << cellArray[dataPtr] << "\n";
-            std::cin.get();
+    for(const auto &pass : passes)
+        if(passEnabled(pass))
+        {
 
-            break;
+            const std::size_t before = mCode.size();
+            const Clock::time_point start = Clock::now();
 
-        case OPend:
-            goto finish;
+            (this->*pass.run)();
 
+            const double time = std::chrono::duration<double,std::milli>(Clock::now() - start).count();
+            total += time;
 
-        default:
-            break;
+            if(mOptions.timePasses)
+                std::cerr << std::setw(columnW) << pass.name << std::setw(columnW) << std::fixed << std::setprecision(3) << time
+                          << std::setw(columnW) << before << std::setw(columnW) << mCode.size() << "\n";
 
         }
 
-        ++toExecute;
-
-    }
+    if(mOptions.timePasses)
+        std::cerr << std::setw(columnW) << "total" << std::setw(columnW) << total << "\n\n";
 
-finish:;
+    // The passes work in place and leave the room of the parsed code behind
+    mCode.shrink_to_fit();
 
 }
 
-void Interpreter::init(std::size_t arraySize)
+
+void Interpreter::partiallyEvaluate()
 {
 
-    mCellArray = CellArray(arraySize);
+    // Profiles measure the program, not what is left of it, and step limits count its steps
+    if(mOptions.profile || mOptions.maxSteps)
+        return;
 
-}
+    switch(mOptions.cellBits)
+    {
 
+    case 8:
 
-void Interpreter::optimizeLoops()
-{
+        evaluatePrefix<std::uint8_t>();
 
-    Code optimizedCode;
-    std::map <decltype(Instruction::parameter),decltype(Instruction::parameter)> mulAddOpcodes;
-    LoopStack loopStack;
+        break;
 
-    Instruction currentInstr;
-    int relativePointer = 0;
-    bool scanLoop = false;
+    case 16:
 
+        evaluatePrefix<std::uint16_t>();
 
-    for(std::size_t i = 0; i < mCode.size(); ++i)
-    {
+        break;
 
-        currentInstr = mCode[i];
+    case 32:
 
-        if(!scanLoop)
-        {
+        evaluatePrefix<std::uint32_t>();
 
-            if(currentInstr.opcode == OPjumpOnZero )
-            {
+        break;
 
-                //Is this loop to optimize, if yes start scan
-                if(mLoopsToOptimize.find(i) != mLoopsToOptimize.end())
-                    scanLoop = true;
+    case 64:
 
-                else
-                {
+        evaluatePrefix<std::uint64_t>();
 
-                    optimizedCode.push_back(currentInstr);
-                    loopStack.push(optimizedCode.size() - 1);
+        break;
 
-                }
+    }
 
-            }
+}
 
-            //Correct loop jumps
-            else if(currentInstr.opcode == OPjumpOnNonZero)
-            {
 
-                currentInstr.parameter = loopStack.top();
-                optimizedCode.push_back(currentInstr);
-                optimizedCode[loopStack.top()].parameter = optimizedCode.size() - 1;
-                loopStack.pop();
+/*
 
-            }
-            else
-                optimizedCode.push_back(currentInstr);
+Lowers the optimized code to CompactInstructions for the interpreting engines.
+Jump targets are remapped to the index of the lowered jump itself, so a taken
+jump skips the OPmovePtr/OPeditVal split off in front of its target.
 
-        }
+*/
+void Interpreter::lowerCode()
+{
 
-        //Scan loop to optimize
-        else
-        {
+    auto fits = [](std::int32_t value,std::int32_t min,std::int32_t max)
+    {
 
-            switch(currentInstr.opcode)
-            {
+        return value >= min && value <= max;
 
-            case OPeditVal:
+    };
 
-                //Dont care about counter variable
-                if(relativePointer != 0)
-                   mulAddOpcodes[relativePointer] += currentInstr.parameter;
+    auto fitsByte = [&](std::int32_t value) { return fits(value,INT8_MIN,INT8_MAX); };
 
-                break;
+    // Index of the lowered form of every instruction
+    std::vector <std::int32_t> &lowered = mLoweredIndex;
+    lowered.assign(mCode.size(),0);
+    std::int32_t size = 0;
 
-            case OPmovePtr:
+    for(std::size_t i = 0; i < mCode.size(); ++i)
+    {
 
-                relativePointer += currentInstr.parameter;
+        const Instruction &instr = mCode[i];
 
-                break;
+        size += !fitsHalf(instr.parameter3) + !fitsByte(instr.parameter4);
+        lowered[i] = size++;
 
-            case OPjumpOnNonZero:
+        // Cell instructions move back after a split off move
+        if(!endsBlock(instr.opcode) && !fitsHalf(instr.parameter3))
+            ++size;
 
-                scanLoop = false;
-                relativePointer = 0;
+        if((instr.opcode == OPmulAdd || instr.opcode == OPmulAddZero)
+           && !(fitsHalf(instr.parameter) && fitsHalf(instr.parameter2)))
+            ++size;
 
-                /*
+        if(instr.opcode == OPproduct)
+            size += 2;
 
-                    Map stores elements in ascending ordered
-                    Based on that, this code [<->-<<+>>] is optimized to
+    }
 
-                    mulAdd -2, 1, 0
-                    mulAddZero -1, -1, 0
+    mCompactCode.clear();
+    mCompactCode.reserve(size);
 
-                    Order does not affect code equivalence
+    auto push = [&](Opcode opcode,std::int32_t edit,std::int32_t move,std::int32_t operand)
+    {
 
-                */
+        mCompactCode.push_back({static_cast<std::uint8_t>(opcode),static_cast<std::int8_t>(edit),
+                                static_cast<std::int16_t>(move),operand});
 
-                // Zero for OPsetZero
-                if(mulAddOpcodes.size())
-                    for(auto iter = mulAddOpcodes.cbegin(); iter != mulAddOpcodes.cend(); ++iter)
-                    {
+    };
 
-                        //Skip any instructions with zero increment
-                        if(iter->second != 0)
-                        {
+    for(const auto &instr : mCode)
+    {
 
-                            Instruction instr;
+        std::int32_t move = instr.parameter3;
+        std::int32_t edit = instr.parameter4;
 
-                            instr.parameter = iter->first;
-                            instr.parameter2 = iter->second;
+        if(!fitsHalf(move))
+        {
 
-                            if(iter != --mulAddOpcodes.cend())
-                                instr.opcode = OPmulAdd;
+            push(OPmovePtr,0,0,move);
+            move = 0;
 
-                            else
-                                instr.opcode = OPmulAddZero;
+        }
 
-                            optimizedCode.push_back(instr);
+        // Lands on the cell the instruction addresses, whether it moves the pointer or not
+        if(!fitsByte(edit))
+        {
 
-                        }
+            push(OPeditVal,0,move,edit);
+            edit = 0;
 
-                    }
+        }
 
-                else
-                {
+        switch(instr.opcode)
+        {
 
-                    Instruction instr;
-                    instr.opcode = OPsetZero;
-                    optimizedCode.push_back(instr);
+        case OPjumpOnZero:
+        case OPjumpOnNonZero:
 
-                }
+            push(instr.opcode,edit,move,lowered[instr.parameter]);
 
-                mulAddOpcodes.clear();
+            break;
 
-                break;
+        case OPmulAdd:
+        case OPmulAddZero:
 
-            // Supress warnings
-            default:
-                break;
+            if(fitsHalf(instr.parameter) && fitsHalf(instr.parameter2))
+                push(instr.opcode,edit,move,packPair(instr.parameter,instr.parameter2));
 
+            else
+            {
+
+                push(instr.opcode == OPmulAdd ? OPmulAddWide : OPmulAddZeroWide,edit,move,instr.parameter);
+                push(OPend,0,0,instr.parameter2);
 
             }
 
-        }
+            break;
 
-    }
+        case OPproduct:
 
-    mCode = std::move(optimizedCode);
+            push(instr.opcode,edit,move,lowHalf(instr.parameter));
+            push(OPend,0,0,instr.parameter2);
+            push(OPend,0,0,highHalf(instr.parameter));
 
-    #if !defined(NDEBUG)
+            break;
 
-    dumpCode(mCode,"OL1.txt");
+        default:
 
-    #endif
+            push(instr.opcode,edit,move,instr.parameter);
 
-}
+            break;
 
+        }
 
-void Interpreter::performOptimizations()
-{
+        if(!endsBlock(instr.opcode) && move != instr.parameter3)
+            push(OPmovePtr,0,0,-instr.parameter3);
 
-    optimizeLoops();
-    findZeroOptimize();
-    stripEditVal();
-    stripMovePtr();
+    }
 
 }
 
 
-void Interpreter::stripMovePtr()
+/*
+
+Rewrites every straight-line block relative to the pointer at its entry.
+Pointer moves inside the block disappear, cell instructions get their offset in parameter3
+and the instruction ending the block moves the pointer once. Edits commute with each other,
+so they are collected per offset and emitted only when their cell is read or the block ends,
+the edit of the accessed cell travels in parameter4.
+
+*/
+void Interpreter::offsetBlocks()
 {
 
-    int movePtrVal = 0;
-    Code optimizedCode;
+    CodeWriter optimizedCode(mCode,mSourcePos);
     LoopStack loopStack;
+    // Edits not emitted yet, by offset from the block entry
+    std::map <decltype(Instruction::parameter),decltype(Instruction::parameter)> pendingEdits;
+    decltype(Instruction::parameter) offset = 0;
 
-    for(auto currentInstr : mCode)
+    #if !defined(NDEBUG)
+
+    std::vector <std::pair<std::size_t,std::size_t>> blocks;
+    std::size_t blockStart = 0;
+    std::size_t blockSize = 0;
+
+    #endif
+
+    auto takeEdit = [&](decltype(Instruction::parameter) at)
     {
 
-        switch(currentInstr.opcode)
+        auto iter = pendingEdits.find(at);
+        decltype(Instruction::parameter) edit = 0;
+
+        if(iter != pendingEdits.end())
         {
 
-            case OPmovePtr:
+            edit = iter->second;
+            pendingEdits.erase(iter);
 
-                movePtrVal = currentInstr.parameter;
+        }
 
-                break;
+        return edit;
 
-            default:
+    };
 
+    // Flushed edits execute where the instruction at sourcePos does
+    auto flushEdits = [&](decltype(Instruction::parameter) sourcePos)
+    {
 
-                currentInstr.parameter3 = movePtrVal;
-                movePtrVal = 0;
+        for(const auto &edit : pendingEdits)
+            if(edit.second)
+            {
 
-                switch(currentInstr.opcode)
-                {
+                Instruction instr(OPeditVal,edit.second);
+                instr.parameter3 = edit.first;
+                optimizedCode.push_back(instr,sourcePos);
 
-                    case OPjumpOnZero:
+            }
 
-                        optimizedCode.push_back(currentInstr);
-                        loopStack.push(optimizedCode.size() - 1);
+        pendingEdits.clear();
 
-                        break;
+    };
 
-                    case OPjumpOnNonZero:
+    for(std::size_t i = 0; i < mCode.size(); ++i)
+    {
 
-                        currentInstr.parameter = loopStack.top();
-                        optimizedCode.push_back(currentInstr);
-                        optimizedCode[loopStack.top()].parameter = optimizedCode.size() - 1;
-                        loopStack.pop();
+        Instruction currentInstr = mCode[i];
+        const std::int32_t sourcePos = optimizedCode.sourcePos(i);
+        Opcode op = currentInstr.opcode;
 
-                        break;
+        #if !defined(NDEBUG)
 
-                    default:
+        ++blockSize;
 
-                        optimizedCode.push_back(currentInstr);
+        #endif
 
-                        break;
+        switch(op)
+        {
 
-                }
+        case OPmovePtr:
 
-                break;
+            offset += currentInstr.parameter;
 
-        }
+            break;
 
-    }
+        case OPeditVal:
 
-    mCode = std::move(optimizedCode);
+            pendingEdits[offset] += currentInstr.parameter;
 
-    #if !defined(NDEBUG)
+            break;
 
-    dumpCode(mCode,"OL4.txt");
+        case OPsetZero:
 
-    #endif
+            // Overwritten anyway
+            pendingEdits.erase(offset);
+            currentInstr.parameter3 = offset;
+            optimizedCode.push_back(currentInstr,sourcePos);
 
-}
+            break;
 
-void Interpreter::stripEditVal()
-{
+        case OPproduct:
 
-    Code optimizedCode;
-    LoopStack loopStack;
-    Instruction lastInstr;
+            // The second factor is read as well
+            if(decltype(Instruction::parameter) edit = takeEdit(offset + highHalf(currentInstr.parameter)))
+            {
 
+                Instruction instr(OPeditVal,edit);
+                instr.parameter3 = offset + highHalf(currentInstr.parameter);
+                optimizedCode.push_back(instr,sourcePos);
 
-    for(auto currentInstr : mCode)
-    {
+            }
 
-        Opcode op = currentInstr.opcode;
+            // Fall through
 
-        if(op != OPmovePtr && op != OPeditVal)
-        {
+        case OPmulAdd:
+        case OPmulAddZero:
 
-            if(optimizedCode.size())
-            {
+            // Edits of the target commute with the addition
+            currentInstr.parameter3 = offset;
+            currentInstr.parameter4 = takeEdit(offset);
+            optimizedCode.push_back(currentInstr,sourcePos);
 
-                lastInstr = optimizedCode.back();
+            break;
 
-                if(lastInstr.opcode == OPeditVal)
-                {
+        case OPtripCount:
 
-                    optimizedCode.resize(optimizedCode.size() - 1);
-                    currentInstr.parameter4 = lastInstr.parameter;
+            // Executes again for as long as the loop would not end, the edit must not repeat with it
+            currentInstr.parameter3 = offset;
 
-                }
+            if(decltype(Instruction::parameter) edit = takeEdit(offset))
+            {
+
+                Instruction instr(OPeditVal,edit);
+                instr.parameter3 = offset;
+                optimizedCode.push_back(instr,sourcePos);
 
             }
 
+            optimizedCode.push_back(currentInstr,sourcePos);
+
+            break;
+
+        case OPprint:
+        case OPread:
+        case OPdebug:
+
+            // Keep the tape in program order around I/O
+            currentInstr.parameter3 = offset;
+            currentInstr.parameter4 = takeEdit(offset);
+            flushEdits(sourcePos);
+            optimizedCode.push_back(currentInstr,sourcePos);
+
+            break;
+
+        default:
+
+            assert(endsBlock(op));
+
+            currentInstr.parameter3 = offset;
+            currentInstr.parameter4 = takeEdit(offset);
+            flushEdits(sourcePos);
+            offset = 0;
 
             if(op == OPjumpOnZero)
             {
 
-                optimizedCode.push_back(currentInstr);
+                optimizedCode.push_back(currentInstr,sourcePos);
                 loopStack.push(optimizedCode.size() - 1);
 
             }
@@ -679,26 +2485,34 @@ void Interpreter::stripEditVal()
             {
 
                 currentInstr.parameter = loopStack.top();
-                optimizedCode.push_back(currentInstr);
+                optimizedCode.push_back(currentInstr,sourcePos);
                 optimizedCode[loopStack.top()].parameter = optimizedCode.size() - 1;
                 loopStack.pop();
 
             }
             else
-                optimizedCode.push_back(currentInstr);
+                optimizedCode.push_back(currentInstr,sourcePos);
 
-        }
+            #if !defined(NDEBUG)
 
-        else
-            optimizedCode.push_back(currentInstr);
+            blocks.push_back({blockSize,optimizedCode.size() - blockStart});
+            blockStart = optimizedCode.size();
+            blockSize = 0;
+
+            #endif
+
+            break;
+
+        }
 
     }
 
-    mCode = std::move(optimizedCode);
+    optimizedCode.finish();
 
     #if !defined(NDEBUG)
 
-    dumpCode(mCode,"OL3.txt");
+    dumpCode("OL3.txt");
+    dumpBlocks(blocks,"blocks.txt");
 
     #endif
 
@@ -707,18 +2521,21 @@ void Interpreter::stripEditVal()
 void Interpreter::findZeroOptimize()
 {
 
-    Code optimizedCode;
+    CodeWriter optimizedCode(mCode,mSourcePos);
     LoopStack loopStack;
 
-    for(auto currentInstr : mCode)
+    for(std::size_t i = 0; i < mCode.size(); ++i)
     {
 
+        Instruction currentInstr = mCode[i];
+        const std::int32_t sourcePos = optimizedCode.sourcePos(i);
+
         switch(currentInstr.opcode)
         {
 
         case OPjumpOnZero:
 
-            optimizedCode.push_back(currentInstr);
+            optimizedCode.push_back(currentInstr,sourcePos);
             loopStack.push(optimizedCode.size() - 1);
 
             break;
@@ -733,17 +2550,18 @@ void Interpreter::findZeroOptimize()
                 Instruction instr;
                 instr.opcode = OPfindZero;
                 instr.parameter = optimizedCode.back().parameter;
+                const std::int32_t loopPos = optimizedCode.sourcePos(loopStack.top());
 
                 // Delete movePtr and jumpOnZero and insert findZero instr
                 optimizedCode.resize(optimizedCode.size() - 2);
-                optimizedCode.push_back(instr);
+                optimizedCode.push_back(instr,loopPos);
 
             }
             else
             {
 
                 currentInstr.parameter = loopStack.top();
-                optimizedCode.push_back(currentInstr);
+                optimizedCode.push_back(currentInstr,sourcePos);
                 optimizedCode[loopStack.top()].parameter = optimizedCode.size() - 1;
 
             }
@@ -754,7 +2572,7 @@ void Interpreter::findZeroOptimize()
 
         default:
 
-            optimizedCode.push_back(currentInstr);
+            optimizedCode.push_back(currentInstr,sourcePos);
 
             break;
 
@@ -763,11 +2581,11 @@ void Interpreter::findZeroOptimize()
     }
 
 
-    mCode = std::move(optimizedCode);
+    optimizedCode.finish();
 
     #if !defined(NDEBUG)
 
-    dumpCode(mCode,"OL2.txt");
+    dumpCode("OL2.txt");
 
     #endif
 
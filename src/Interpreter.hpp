@@ -2,48 +2,185 @@
 #define INTERPRETER_HPP
 
 #include <vector>
+#include <memory>
 #include <set>
+#include <utility>
 #include <stack>
 #include <string>
+#include <iosfwd>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <cassert>
+#include "OutputSink.hpp"
+#include "InputSource.hpp"
+#include "SourceFile.hpp"
+#include "Tape.hpp"
+
+class Debugger;
+class Watchdog;
 
 class Interpreter
 {
 
 public:
 
-    void run(std::ifstream &sourceFile,std::istream &stdInput,std::size_t arraySize,bool debugMode);
+    enum class Engine
+    {
+
+        switchDispatch, // Portable, one shared dispatch branch
+        threaded, // Direct-threaded, needs computed goto support
+        jit, // Native x86-64 code
+        tiered // Switch dispatch, hot loops are compiled to native code in the background
+
+    };
+
+    // Best engine supported by the compiler
+    static const Engine defaultEngine;
+    static const unsigned maxOptLevel = 3;
+
+    struct Options
+    {
+
+        // Number of cells on each side of the starting cell
+        std::size_t arraySize;
+        // Width of a cell, one of 8, 16, 32 or 64
+        unsigned cellBits;
+        // Stop at '#' and at breakpoints, the code between stops is still optimized
+        bool debugMode;
+        // Source offsets to stop at in debug mode, before the first command at or after each
+        std::set <std::size_t> breakpoints;
+        // Back the tape with transparent huge pages when available
+        bool hugePages;
+        // Count executed instructions and report hot loops to stderr, runs on the switch engine
+        bool profile;
+        Engine engine;
+        // 0 to 3, picks the passes that run unless named below
+        unsigned optLevel;
+        // Passes run or skipped regardless of the level, by name
+        std::set <std::string> enabledPasses;
+        std::set <std::string> disabledPasses;
+        // Report time and instruction count change of every pass to stderr
+        bool timePasses;
+        // Check every folded nested loop against the loop on sample tapes, a wrong fold is an error
+        bool verifyFolds;
+        // Directory of optimized programs reused across runs, empty disables the cache
+        std::string cacheDir;
+        // Steps (taken back edges, folded loops spend the ones they replace) and seconds a run may take, zero for no limit
+        std::uint64_t maxSteps;
+        double timeout;
+
+        Options():arraySize(10000),cellBits(32),debugMode(false),hugePages(false),profile(false),engine(defaultEngine),
+            optLevel(maxOptLevel),timePasses(false),verifyFolds(false),maxSteps(0),timeout(0){}
+
+    };
+
+    // Wall clock seconds spent in each phase of a run
+    struct PhaseTimes
+    {
+
+        // Loading from the cache when the program is found there
+        double parse;
+        // Lowering or native code generation for the engine included
+        double optimize;
+        double execute;
+
+        PhaseTimes():parse(0),optimize(0),execute(0){}
+
+    };
+
+    // Writes the optimized program as C source instead of running it
+    void emitC(const SourceFile &sourceFile,const Options &options,const std::string &filename);
+
+    static bool validCellBits(unsigned cellBits);
+    static bool validPass(const std::string &name);
+    // Pass names in the order they run, separated by commas
+    static std::string passNames();
 
 private:
 
-    void parseFile(std::ifstream &sourceFile,bool debugMode);
-    void executeCode(std::istream &stdInput);
-    void init(std::size_t arraySize);
+    // Program and Execution are the interface, the interpreter only holds the compiled code
+    friend class Program;
+    friend class Execution;
+
+    // What a single run writes to, kept by its Execution
+    struct RunState;
+
+    // Parses, optimizes and prepares the code for the engine in options
+    void compile(const char *source,std::size_t size,const Options &options);
+    void parseFile(const char *source,std::size_t size,bool debugMode);
+    // Entry of the source in mOptions.cacheDir, key is the hash of the source and options
+    std::string cachePath(const char *source,std::size_t size,std::uint64_t &key) const;
+    // Takes the optimized code from the cache, false when the entry is missing, stale or corrupted
+    bool loadCached(const char *source,std::size_t size);
+    // Saves the optimized code for loadCached, a failed write leaves the cache as it was
+    void storeCached(const char *source,std::size_t size) const;
+    template <typename CellType>
+    void execute(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const;
+    // Runs the interpreting engine in mOptions, Limited engines spend steps for state.watchdog
+    template <typename CellType,bool Limited>
+    void executeEngine(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const;
+    template <typename CellType,bool Profiling,bool Tiered,bool Limited>
+    void executeCode(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const;
+    template <typename CellType,bool Limited>
+    void executeCodeThreaded(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const;
+    // Generates the native code run by executeCodeJit
+    template <typename CellType>
+    void compileJit();
+    // Native code of mCode[begin,end), a loop takes its cell and returns the pointer after it
+    template <typename CellType>
+    std::vector <std::uint8_t> generateNative(std::size_t begin,std::size_t end,bool loop) const;
+    template <typename CellType>
+    void executeCodeJit(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const;
+    void writeC(std::ostream &out);
+    void reportProfile(const std::vector <std::uint64_t> &counts,std::ostream &out) const;
+    void init(const Options &options);
+    std::size_t maxAccessDistance() const;
     void optimizeLoops();
+    void foldNestedLoops();
     void performOptimizations();
-    void stripMovePtr();
-    void stripEditVal();
+    void offsetBlocks();
     void findZeroOptimize();
+    template <typename CellType>
+    void evaluatePrefix();
+    // evaluatePrefix for the cell size in mOptions
+    void partiallyEvaluate();
+    void lowerCode();
 
     enum Opcode
     {
 
         OPeditVal, // parameter1 - offset
         OPmovePtr, // parameter1 - offset
-        OPjumpOnZero, // parameter1 - index of next instr on branch
+        OPjumpOnZero, // parameter1 - index of next instr on branch, parameter2 - set by parseFile on loops optimizeLoops folds
         OPjumpOnNonZero, // parameter1 - index of next instr on branch
         OPmulAdd, // parameter1 - relative offset, parameter2 - increment
         OPmulAddZero,
         OPsetZero,
         OPfindZero, //parameter1 - step
+        OPtripCount, // parameter1 - counter step, replaces the counter with the number of iterations
+        OPproduct, // parameter1 - relative offsets of the target and of the second factor packed by packPair, parameter2 - increment
+        OPwrite, // Writes mPrefixOutput
+        OPloadTape, // Copies mPrefixTape to the cells starting at the addressed one
         OPprint,
         OPread,
         OPdebug,
-        OPend
+        OPend,
+
+        // Compact code only, operand - relative offset, next slot operand - increment
+        OPmulAddWide,
+        OPmulAddZeroWide
 
     };
 
+    /*
+
+    Once offsetBlocks has run, instructions inside a straight-line block address their cell
+    at offset parameter3 from the pointer and leave the pointer alone. Only the instructions
+    that end a block (see endsBlock) move the pointer, by parameter3, before they execute.
+    parameter4 is added to the addressed cell before the instruction executes.
+
+    */
     struct Instruction
     {
 
@@ -51,7 +188,7 @@ private:
         std::int32_t parameter;
         decltype(parameter) parameter2;
 
-        // Avoid decoding OPmovePtr
+        // Cell offset, or pointer move for instructions ending a block
         decltype(parameter)  parameter3;
         // Avoid decoding OPeditVal
         decltype(parameter)  parameter4;
@@ -59,23 +196,272 @@ private:
         Instruction():parameter(0),parameter2(0),parameter3(0),parameter4(0){}
 
         Instruction(Opcode op,decltype(parameter) parameter)
-                    :opcode(op),parameter(parameter),parameter2(0),parameter3(0),
-                    parameter4(0){}
+                    :opcode(op),parameter(parameter),parameter2(0),parameter3(0),parameter4(0){}
 
         explicit Instruction(Opcode op):opcode(op),parameter(0),parameter2(0),parameter3(0),parameter4(0){}
 
     };
 
+    /*
+
+    8-byte executable form of an Instruction produced by lowerCode.
+    parameter3 and parameter4 are stored in the narrow move and edit fields, values that do not
+    fit are emitted as separate OPmovePtr and OPeditVal instructions around it.
+    OPmulAdd and OPmulAddZero pack offset and increment as 16-bit halves of operand, the
+    wide forms take the increment from the following slot. OPproduct always takes the
+    increment and the offset of its second factor from the two following slots.
+
+    */
+    struct CompactInstruction
+    {
+
+        std::uint8_t opcode;
+        std::int8_t edit;
+        std::int16_t move;
+        std::int32_t operand;
+
+    };
+
+    // Instruction of the threaded engine, handler is the address of the opcode's label
+    struct ThreadedInstruction
+    {
+
+        const void *handler;
+        CompactInstruction instr;
+
+    };
+
     using Code = std::vector <Instruction>;
-    using CellType = std::uint32_t;
-    using LoopStack = std::stack <decltype(Instruction::parameter)>;
-    using CellArray = std::vector <CellType>;
+    // Source offset of the command, or of the loop, each instruction was made from
+    using SourcePositions = std::vector <std::int32_t>;
+    using CompactCode = std::vector <CompactInstruction>;
+    using ThreadedCode = std::vector <ThreadedInstruction>;
+
+    // Native code of a single loop, compiled by a tiered run
+    using LoopFunction = void *(*)(void *cell,void *context);
+    class LoopCompiler;
+
+    struct RunState
+    {
+
+        // Executions of every instruction of mCompactCode, filled in by profiling runs
+        std::vector <std::uint64_t> counts;
+        // Outside of the engine's frame, so a tape overflow can jump over it without leaking it
+        ThreadedCode threadedCode;
+        // Handles OPdebug, set in debug mode
+        Debugger *debugger;
+        // Enforces the step and time limits, set when there are any
+        Watchdog *watchdog;
+        // Taken back edges of every OPjumpOnNonZero of mCompactCode and the loops compiled so far, tiered runs only
+        std::vector <std::uint32_t> backEdges;
+        std::shared_ptr<LoopCompiler> loopCompiler;
+
+        RunState():debugger(nullptr),watchdog(nullptr){}
+
+    };
+
+    static std::int32_t packPair(std::int32_t low,std::int32_t high)
+    {
+
+        return static_cast<std::int32_t>((static_cast<std::uint32_t>(high) << 16) | (static_cast<std::uint32_t>(low) & 0xFFFF));
+
+    }
+
+    // Instructions whose parameter3 moves the pointer instead of addressing a cell
+    static bool endsBlock(Opcode opcode)
+    {
+
+        return opcode == OPjumpOnZero || opcode == OPjumpOnNonZero || opcode == OPfindZero || opcode == OPend;
+
+    }
+
+    static std::int32_t lowHalf(std::int32_t pair) { return static_cast<std::int16_t>(pair & 0xFFFF); }
+    static std::int32_t highHalf(std::int32_t pair) { return pair >> 16; }
+    using LoopStack = std::stack <decltype(Instruction::parameter),std::vector <decltype(Instruction::parameter)>>;
+
+    /*
+
+    Output of a pass that rewrites mCode in place. A pass that never emits more instructions
+    than it has read so far writes over instructions it is done with, so the code never
+    exists twice. finish drops what is left behind the output. The source positions, when
+    kept, are rewritten along with the code.
+
+    */
+    class CodeWriter
+    {
+
+    public:
+
+        CodeWriter(Code &code,SourcePositions &positions):mCode(code),mPositions(positions),mSize(0){}
+
+        void push_back(const Instruction &instr,std::int32_t sourcePos)
+        {
+
+            assert(mSize < mCode.size());
+
+            if(!mPositions.empty())
+                mPositions[mSize] = sourcePos;
+
+            mCode[mSize++] = instr;
+
+        }
+
+        Instruction &operator[](std::size_t index) { return mCode[index]; }
+        Instruction &back() { return mCode[mSize - 1]; }
+        std::size_t size() const { return mSize; }
+        // Zero when the positions are not kept
+        std::int32_t sourcePos(std::size_t index) const { return mPositions.empty() ? 0 : mPositions[index]; }
+
+        // Only shrinks
+        void resize(std::size_t size) { mSize = size; }
+
+        void finish()
+        {
+
+            mCode.resize(mSize);
+
+            if(!mPositions.empty())
+                mPositions.resize(mSize);
+
+        }
+
+    private:
+
+        Code &mCode;
+        SourcePositions &mPositions;
+        std::size_t mSize;
+
+    };
+
+    struct Pass
+    {
+
+        const char *name;
+        // Lowest optimization level that runs the pass
+        unsigned level;
+        void (Interpreter::*run)();
+
+    };
+
+    // Every optimization pass, in the order they run
+    static const Pass passes[];
+
+    bool passEnabled(const Pass &pass) const;
+    // Profile reports, fold checks and the code dumps of debug builds name source positions
+    bool keepSourcePositions() const;
+
+    // Wrapping cell * factor, narrow cells are multiplied as unsigned to avoid int overflow
+    template <typename CellType>
+    static CellType multiply(CellType cell,decltype(Instruction::parameter) factor)
+    {
+
+        using Arithmetic = typename std::common_type<CellType,unsigned>::type;
+
+        return static_cast<CellType>(static_cast<Arithmetic>(cell) * static_cast<Arithmetic>(factor));
+
+    }
+
+    template <typename CellType>
+    static CellType multiplyCells(CellType cell,CellType other)
+    {
+
+        using Arithmetic = typename std::common_type<CellType,unsigned>::type;
+
+        return static_cast<CellType>(static_cast<Arithmetic>(cell) * static_cast<Arithmetic>(other));
+
+    }
+
+    /*
+
+    Replaces the counter of a folded loop that adds step to it every iteration with the
+    number of iterations until it reaches zero. Returns false, leaving the counter alone,
+    when it never does. Cells wrap, so the count is the solution of
+    counter + count * step = 0 modulo 2^bits, found with the inverse of the odd part of step.
+
+    */
+    template <typename CellType>
+    static bool tripCount(CellType &counter,decltype(Instruction::parameter) step)
+    {
+
+        using Arithmetic = typename std::common_type<CellType,unsigned>::type;
+
+        Arithmetic odd = static_cast<CellType>(step);
+        const Arithmetic mask = static_cast<CellType>(~static_cast<CellType>(0));
+        unsigned shift = 0;
+
+        if(!counter)
+            return true;
+
+        if(!odd)
+            return false;
+
+        while(!(odd & 1))
+        {
+
+            odd >>= 1;
+            ++shift;
+
+        }
+
+        // Only multiples of the power of two part of step are reachable
+        if(counter & ((Arithmetic(1) << shift) - 1))
+            return false;
+
+        // Newton iteration, every step doubles the number of correct low bits (3 to begin with)
+        Arithmetic inverse = odd;
+
+        for(int i = 0; i < 5; ++i)
+            inverse *= 2 - odd * inverse;
+
+        Arithmetic negated = (Arithmetic(0) - counter) & mask;
+        counter = static_cast<CellType>(((negated >> shift) * inverse) & (mask >> shift));
+
+        return true;
+
+    }
+
+    // tripCount on a cell of the tape, called by native code
+    template <typename CellType>
+    static bool tripCountCell(void *cell,std::int32_t step) { return tripCount(*static_cast<CellType *>(cell),step); }
+
+    template <typename CellType>
+    void loadPrefixTape(CellType *cell) const
+    {
+
+        for(std::size_t i = 0; i < mPrefixTape.size(); ++i)
+            cell[i] = static_cast<CellType>(mPrefixTape[i]);
+
+    }
+
+    static const char *opcodeName(Opcode opcode);
+    static bool foldLoopBody(Code::const_iterator begin,Code::const_iterator end,Code &tail);
+    static bool verifyFold(const Code &body,const Code &folded);
 
-    void dumpCode(const Code &code,const std::string &filename);
+    // Writes mCode and its source positions
+    void dumpCode(const std::string &filename) const;
+    // Instruction count of every block before and after offsetBlocks
+    void dumpBlocks(const std::vector <std::pair<std::size_t,std::size_t>> &blocks,const std::string &filename);
 
     Code mCode;
-    CellArray mCellArray;
-    std::set <decltype(Instruction::parameter)> mLoopsToOptimize;
+    // Source position of every instruction of mCode, empty unless keepSourcePositions
+    SourcePositions mSourcePos;
+    CompactCode mCompactCode;
+    Options mOptions;
+    // Output and tape contents of the input independent prefix evaluated by evaluatePrefix
+    std::string mPrefixOutput;
+    std::vector <std::uint64_t> mPrefixTape;
+    // Index of the lowered form of every instruction of mCode
+    std::vector <std::int32_t> mLoweredIndex;
+    // Source text, only kept for the profile report
+    std::string mSource;
+    // Native code of the JIT engine, generated by compile and shared by every run
+    class NativeCode;
+    std::shared_ptr <const NativeCode> mNativeCode;
+    // Guard cells the tape needs, see maxAccessDistance
+    std::size_t mGuardCells;
+    // The optimized code outlives the process, in the cache or as C, and is worth a longer prefix evaluation
+    bool mCodeReused;
+    PhaseTimes mPhaseTimes;
 
 };
 
@@ -0,0 +1,1328 @@
+#include "Interpreter.hpp"
+#include "FindZero.hpp"
+#include "Debugger.hpp"
+#include "LoopCompiler.hpp"
+#include "Watchdog.hpp"
+#include <vector>
+#include <memory>
+#include <string>
+#include <stack>
+#include <stdexcept>
+#include <initializer_list>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && defined(__unix__)
+#define BF_JIT
+#endif
+
+#if defined(BF_JIT)
+
+#include <sys/mman.h>
+
+namespace
+{
+
+/*
+
+State shared between generated code and the runtime.
+Generated code keeps a pointer to it in r12 and calls the I/O callbacks through it.
+
+*/
+struct JitContext
+{
+
+    void (*print)(JitContext *context,std::uint64_t value);
+    void (*read)(JitContext *context,void *cell);
+    void (*debug)(JitContext *context,std::int32_t codePos,void *cell);
+    void *(*findZero)(void *cell,std::ptrdiff_t step);
+    bool (*tripCount)(void *cell,std::int32_t step);
+    void (*write)(JitContext *context);
+    void (*loadTape)(JitContext *context,void *cell);
+    std::uint64_t (*refill)(JitContext *context,std::uint64_t shortfall);
+
+    // Steps left, kept in rbp while native code runs with limits
+    std::uint64_t budget;
+    Watchdog *watchdog;
+    InputSource *input;
+    OutputSink *output;
+    void *cells;
+    const std::string *prefixOutput;
+    const std::vector <std::uint64_t> *prefixTape;
+    Debugger *debugger;
+
+};
+
+void printCallback(JitContext *context,std::uint64_t value)
+{
+
+    context->output->put(static_cast<char>(value));
+
+}
+
+void writeCallback(JitContext *context)
+{
+
+    context->output->write(context->prefixOutput->data(),context->prefixOutput->size());
+
+}
+
+template <typename CellType>
+void loadTapeCallback(JitContext *context,void *cell)
+{
+
+    const std::vector <std::uint64_t> &values = *context->prefixTape;
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+        static_cast<CellType *>(cell)[i] = static_cast<CellType>(values[i]);
+
+}
+
+template <typename CellType>
+void readCallback(JitContext *context,void *cell)
+{
+
+    int stdinChar = context->input->get();
+
+    if(stdinChar != InputSource::eof)
+        *static_cast<CellType *>(cell) = stdinChar;
+
+}
+
+template <typename CellType>
+void debugCallback(JitContext *context,std::int32_t codePos,void *cell)
+{
+
+    CellType *current = static_cast<CellType *>(cell);
+
+    context->debugger->stop(codePos,current,static_cast<CellType *>(context->cells),*context->output);
+
+}
+
+std::uint64_t refillCallback(JitContext *context,std::uint64_t shortfall)
+{
+
+    return context->watchdog->refill(shortfall);
+
+}
+
+template <typename CellType>
+void *findZeroCallback(void *cell,std::ptrdiff_t step)
+{
+
+    static const FindZeroFunction<CellType> findZero = findZeroFunction<CellType>();
+
+    return findZero(static_cast<CellType *>(cell),step);
+
+}
+
+
+/*
+
+Minimal x86-64 encoder for the handful of instructions the backend needs.
+rbx always holds the address of a cell, r12 holds the JitContext and rbp the step
+budget of a run with limits.
+
+*/
+class Assembler
+{
+
+public:
+
+    using Label = std::size_t;
+
+    // Cells are cellSize bytes wide: 1, 2, 4 or 8
+    explicit Assembler(unsigned cellSize):mCellSize(cellSize){}
+
+    const std::vector <std::uint8_t> &code() const { return mCode; }
+
+    Label position() const { return mCode.size(); }
+
+    void prologue()
+    {
+
+        // push rbx; push r12; push rbp (keeps the stack 16-byte aligned for calls)
+        emit({0x53,0x41,0x54,0x55});
+        // mov rbx, rdi; mov r12, rsi
+        emit({0x48,0x89,0xFB,0x49,0x89,0xF4});
+
+    }
+
+    // mov rbp, [r12 + disp]
+    void loadBudget(std::uint8_t disp)
+    {
+
+        emit({0x49,0x8B,0x6C,0x24,disp});
+
+    }
+
+    // mov [r12 + disp], rbp
+    void storeBudget(std::uint8_t disp)
+    {
+
+        emit({0x49,0x89,0x6C,0x24,disp});
+
+    }
+
+    // sub rbp, 1
+    void spendOne()
+    {
+
+        emit({0x48,0x83,0xED,0x01});
+
+    }
+
+    // sub rbp, rax
+    void spendEax()
+    {
+
+        emit({0x48,0x29,0xC5});
+
+    }
+
+    // sub rax, 1; adc rax, 0, the back edges of a loop of rax iterations
+    void backEdgesFromCount()
+    {
+
+        emit({0x48,0x83,0xE8,0x01,0x48,0x83,0xD0,0x00});
+
+    }
+
+    // mov rsi, rbp; neg rsi, the steps a spend that borrowed is short of
+    void shortfallArg2()
+    {
+
+        emit({0x48,0x89,0xEE,0x48,0xF7,0xDE});
+
+    }
+
+    // mov rbp, rax
+    void budgetFromResult()
+    {
+
+        emit({0x48,0x89,0xC5});
+
+    }
+
+    // sub rax, rbx; add rbx, rax; cqo; mov rcx, stride; idiv rcx
+    // rbx = rax, rax = the distance it moved in strides of stride bytes
+    void pointerFromScan(std::int32_t stride)
+    {
+
+        emit({0x48,0x29,0xD8,0x48,0x01,0xC3,0x48,0x99,0x48,0xC7,0xC1});
+        emit32(stride);
+        emit({0x48,0xF7,0xF9});
+
+    }
+
+    // mov rax, rbx
+    void returnPointer()
+    {
+
+        emit({0x48,0x89,0xD8});
+
+    }
+
+    void epilogue()
+    {
+
+        // pop rbp; pop r12; pop rbx; ret
+        emit({0x5D,0x41,0x5C,0x5B,0xC3});
+
+    }
+
+    // add cell [rbx + disp], imm
+    void addCell(std::int32_t disp,std::int32_t imm)
+    {
+
+        cellOperand(0x80,0x81,0x83,disp);
+        cellImmediate(imm);
+
+    }
+
+    // mov cell [rbx + disp], imm
+    void setCell(std::int32_t disp,std::int32_t imm)
+    {
+
+        cellOperand(0xC6,0xC7,0x83,disp);
+        cellImmediate(imm);
+
+    }
+
+    // eax/rax = zero extended cell [rbx + disp]
+    void loadCell(std::int32_t disp)
+    {
+
+        loadCellTo(0x83,disp);
+
+    }
+
+    // ecx/rcx = zero extended cell [rbx + disp]
+    void loadCellEcx(std::int32_t disp)
+    {
+
+        loadCellTo(0x8B,disp);
+
+    }
+
+    // imul rax, rcx, the low bits are right for every cell width
+    void mulEaxEcx()
+    {
+
+        emit({0x48,0x0F,0xAF,0xC1});
+
+    }
+
+    // imul eax/rax, eax/rax, imm
+    void mulEax(std::int32_t imm)
+    {
+
+        if(mCellSize == 8)
+            emit8(0x48);
+
+        emit({0x69,0xC0});
+        emit32(imm);
+
+    }
+
+    // add [rbx + disp], al/ax/eax/rax
+    void addEaxToCell(std::int32_t disp)
+    {
+
+        cellOperand(0x00,0x01,0x83,disp);
+
+    }
+
+    // test eax/rax, eax/rax
+    void testEax()
+    {
+
+        if(mCellSize == 8)
+            emit8(0x48);
+
+        emit({0x85,0xC0});
+
+    }
+
+    // cmp cell [rbx + disp], 0
+    void testCell(std::int32_t disp)
+    {
+
+        cellOperand(0x80,0x83,0xBB,disp);
+        emit8(0);
+
+    }
+
+    // lea rbx, [rbx + disp]
+    void movePtr(std::int32_t disp)
+    {
+
+        emit({0x48,0x8D,0x9B});
+        emit32(disp);
+
+    }
+
+    // mov rax, imm64; add rbx, rax
+    void movePtr64(std::int64_t disp)
+    {
+
+        emit({0x48,0xB8});
+
+        for(int i = 0; i < 8; ++i)
+            emit8(static_cast<std::uint8_t>(static_cast<std::uint64_t>(disp) >> (8 * i)));
+
+        emit({0x48,0x01,0xC3});
+
+    }
+
+    // mov rdi, r12
+    void contextArg()
+    {
+
+        emit({0x4C,0x89,0xE7});
+
+    }
+
+    // esi/rsi = zero extended cell [rbx + disp]
+    void cellValueArg2(std::int32_t disp)
+    {
+
+        loadCellTo(0xB3,disp);
+
+    }
+
+    // lea rsi, [rbx + disp]
+    void cellAddressArg2(std::int32_t disp)
+    {
+
+        emit({0x48,0x8D,0xB3});
+        emit32(disp);
+
+    }
+
+    // lea rdx, [rbx + disp]
+    void cellAddressArg3(std::int32_t disp)
+    {
+
+        emit({0x48,0x8D,0x93});
+        emit32(disp);
+
+    }
+
+    // mov esi, imm
+    void immArg2(std::int32_t imm)
+    {
+
+        emit8(0xBE);
+        emit32(imm);
+
+    }
+
+    // lea rdi, [rbx + disp]
+    void cellAddressArg1(std::int32_t disp)
+    {
+
+        emit({0x48,0x8D,0xBB});
+        emit32(disp);
+
+    }
+
+    // test al, al
+    void testResult()
+    {
+
+        emit({0x84,0xC0});
+
+    }
+
+    // mov rdi, rbx
+    void pointerArg()
+    {
+
+        emit({0x48,0x89,0xDF});
+
+    }
+
+    // mov rsi, sign extended imm
+    void signedImmArg2(std::int32_t imm)
+    {
+
+        emit({0x48,0xC7,0xC6});
+        emit32(imm);
+
+    }
+
+    // mov rbx, rax
+    void pointerFromResult()
+    {
+
+        emit({0x48,0x89,0xC3});
+
+    }
+
+    // call [r12 + disp]
+    void callContext(std::uint8_t disp)
+    {
+
+        emit({0x41,0xFF,0x54,0x24,disp});
+
+    }
+
+    // Jumps return the position of their rel32 field for patching
+
+    Label jumpIfZero()
+    {
+
+        emit({0x0F,0x84});
+        emit32(0);
+
+        return position() - 4;
+
+    }
+
+    Label jumpIfNonZero()
+    {
+
+        emit({0x0F,0x85});
+        emit32(0);
+
+        return position() - 4;
+
+    }
+
+    Label jumpIfNoBorrow()
+    {
+
+        emit({0x0F,0x83});
+        emit32(0);
+
+        return position() - 4;
+
+    }
+
+    Label jump()
+    {
+
+        emit8(0xE9);
+        emit32(0);
+
+        return position() - 4;
+
+    }
+
+    void patch(Label jumpField,Label target)
+    {
+
+        std::int32_t rel = static_cast<std::int32_t>(target - (jumpField + 4));
+        std::memcpy(&mCode[jumpField],&rel,sizeof(rel));
+
+    }
+
+private:
+
+    /*
+
+    Emits opcode and ModRM for a [rbx + disp32] cell operand.
+    byteOpcode is used for 8-bit cells, wideOpcode with a size prefix for the others.
+
+    */
+    void cellOperand(std::uint8_t byteOpcode,std::uint8_t wideOpcode,std::uint8_t modRM,std::int32_t disp)
+    {
+
+        if(mCellSize == 2)
+            emit8(0x66);
+
+        else if(mCellSize == 8)
+            emit8(0x48);
+
+        emit({mCellSize == 1 ? byteOpcode : wideOpcode,modRM});
+        emit32(disp);
+
+    }
+
+    // Immediate operand of an instruction with a cell sized destination, 64-bit cells use a sign extended imm32
+    void cellImmediate(std::int32_t imm)
+    {
+
+        if(mCellSize == 1)
+            emit8(static_cast<std::uint8_t>(imm));
+
+        else if(mCellSize == 2)
+        {
+
+            emit8(static_cast<std::uint8_t>(imm));
+            emit8(static_cast<std::uint8_t>(static_cast<std::uint32_t>(imm) >> 8));
+
+        }
+
+        else
+            emit32(imm);
+
+    }
+
+    // movzx/mov of a cell into the register encoded in modRM
+    void loadCellTo(std::uint8_t modRM,std::int32_t disp)
+    {
+
+        if(mCellSize == 1)
+            emit({0x0F,0xB6,modRM});
+
+        else if(mCellSize == 2)
+            emit({0x0F,0xB7,modRM});
+
+        else if(mCellSize == 4)
+            emit({0x8B,modRM});
+
+        else
+            emit({0x48,0x8B,modRM});
+
+        emit32(disp);
+
+    }
+
+    void emit8(std::uint8_t byte)
+    {
+
+        mCode.push_back(byte);
+
+    }
+
+    void emit(std::initializer_list<std::uint8_t> bytes)
+    {
+
+        mCode.insert(mCode.end(),bytes);
+
+    }
+
+    void emit32(std::int32_t value)
+    {
+
+        for(int i = 0; i < 4; ++i)
+            emit8(static_cast<std::uint8_t>(static_cast<std::uint32_t>(value) >> (8 * i)));
+
+    }
+
+    unsigned mCellSize;
+    std::vector <std::uint8_t> mCode;
+
+};
+
+template <typename CellType>
+void initContext(JitContext &context,InputSource &input,OutputSink &output,Tape &tape,bool (*tripCount)(void *,std::int32_t),
+                 const std::string &prefixOutput,const std::vector <std::uint64_t> &prefixTape,Debugger *debugger,Watchdog *watchdog)
+{
+
+    context.print = printCallback;
+    context.read = readCallback<CellType>;
+    context.debug = debugCallback<CellType>;
+    context.findZero = findZeroCallback<CellType>;
+    context.tripCount = tripCount;
+    context.write = writeCallback;
+    context.loadTape = loadTapeCallback<CellType>;
+    context.refill = refillCallback;
+    context.budget = 0;
+    context.watchdog = watchdog;
+    context.input = &input;
+    context.output = &output;
+    context.cells = tape.origin<CellType>();
+    context.prefixOutput = &prefixOutput;
+    context.prefixTape = &prefixTape;
+    context.debugger = debugger;
+
+}
+
+}
+
+
+// Executable copy of the generated code, writable and executable never at the same time
+class Interpreter::NativeCode
+{
+
+public:
+
+    explicit NativeCode(const std::vector <std::uint8_t> &code):mSize(code.size())
+    {
+
+        mMemory = mmap(nullptr,mSize,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+
+        if(mMemory == MAP_FAILED)
+            throw std::runtime_error("Could not allocate memory for the JIT");
+
+        std::memcpy(mMemory,code.data(),mSize);
+
+        if(mprotect(mMemory,mSize,PROT_READ | PROT_EXEC) != 0)
+        {
+
+            munmap(mMemory,mSize);
+            throw std::runtime_error("Could not make JIT code executable");
+
+        }
+
+    }
+
+    ~NativeCode()
+    {
+
+        munmap(mMemory,mSize);
+
+    }
+
+    NativeCode(const NativeCode &) = delete;
+    NativeCode &operator=(const NativeCode &) = delete;
+
+    void *memory() const { return mMemory; }
+
+private:
+
+    void *mMemory;
+    std::size_t mSize;
+
+};
+
+
+/*
+
+Translates the optimized code to x86-64, once per program.
+Block offsets and pointer moves are tracked at compile time and folded into the
+displacement of the cell accesses, rbx is only updated where the position must be
+known at runtime (loop boundaries, findZero and end).
+
+*/
+template <typename CellType>
+std::vector <std::uint8_t> Interpreter::generateNative(std::size_t begin,std::size_t end,bool loop) const
+{
+
+    const std::int64_t cellSize = sizeof(CellType);
+
+    Assembler assembler(sizeof(CellType));
+    std::stack <std::pair<Assembler::Label,Assembler::Label>> loopStack;
+
+    // Pointer offset (in cells) not yet applied to rbx
+    std::int64_t pendingOffset = 0;
+
+    auto materialize = [&]()
+    {
+
+        std::int64_t disp = pendingOffset * cellSize;
+
+        if(disp == static_cast<std::int32_t>(disp))
+        {
+
+            if(disp)
+                assembler.movePtr(static_cast<std::int32_t>(disp));
+
+        }
+        else
+            assembler.movePtr64(disp);
+
+        pendingOffset = 0;
+
+    };
+
+    // Displacement of the cell at pendingOffset + offset, materializes when it does not fit
+    auto cellDisp = [&](std::int64_t offset) -> std::int32_t
+    {
+
+        std::int64_t disp = (pendingOffset + offset) * cellSize;
+
+        if(disp != static_cast<std::int32_t>(disp))
+        {
+
+            materialize();
+            disp = offset * cellSize;
+
+            if(disp != static_cast<std::int32_t>(disp))
+                throw std::runtime_error("Offset too large for the JIT");
+
+        }
+
+        return static_cast<std::int32_t>(disp);
+
+    };
+
+    const std::uint8_t printSlot = offsetof(JitContext,print);
+    const std::uint8_t readSlot = offsetof(JitContext,read);
+    const std::uint8_t debugSlot = offsetof(JitContext,debug);
+    const std::uint8_t findZeroSlot = offsetof(JitContext,findZero);
+    const std::uint8_t tripCountSlot = offsetof(JitContext,tripCount);
+    const std::uint8_t writeSlot = offsetof(JitContext,write);
+    const std::uint8_t loadTapeSlot = offsetof(JitContext,loadTape);
+    const std::uint8_t refillSlot = offsetof(JitContext,refill);
+    const std::uint8_t budgetSlot = offsetof(JitContext,budget);
+
+    // Back edges and folded iterations are only counted with a step or time limit
+    const bool limited = mOptions.maxSteps || mOptions.timeout > 0;
+
+    // Asks the watchdog for a new budget after a spend that borrowed
+    auto refill = [&]()
+    {
+
+        assembler.contextArg();
+        assembler.shortfallArg2();
+        assembler.callContext(refillSlot);
+        assembler.budgetFromResult();
+
+    };
+
+    // Follows a spend, refills when it borrowed
+    auto refillWhenShort = [&]()
+    {
+
+        Assembler::Label paid = assembler.jumpIfNoBorrow();
+        refill();
+        assembler.patch(paid,assembler.position());
+
+    };
+
+    assembler.prologue();
+
+    if(limited)
+        assembler.loadBudget(budgetSlot);
+
+    for(std::size_t i = begin; i < end; ++i)
+    {
+
+        Instruction instr = mCode[i];
+
+        // The interpreter has already entered the loop, its pointer move and edit are done
+        if(loop && i == begin)
+            instr.parameter3 = instr.parameter4 = 0;
+
+        // Offset of the addressed cell from the pointer
+        std::int64_t offset = 0;
+
+        if(endsBlock(instr.opcode))
+            pendingOffset += instr.parameter3;
+
+        else
+            offset = instr.parameter3;
+
+        if(instr.parameter4 && instr.opcode != OPend)
+            assembler.addCell(cellDisp(offset),instr.parameter4);
+
+        switch(instr.opcode)
+        {
+
+        case OPeditVal:
+
+            assembler.addCell(cellDisp(offset),instr.parameter);
+
+            break;
+
+        case OPmovePtr:
+
+            pendingOffset += instr.parameter;
+
+            break;
+
+        case OPjumpOnZero:
+
+            {
+
+                materialize();
+                assembler.testCell(0);
+                Assembler::Label exitJump = assembler.jumpIfZero();
+                loopStack.push({exitJump,assembler.position()});
+
+            }
+
+            break;
+
+        case OPjumpOnNonZero:
+
+            {
+
+                materialize();
+                assembler.testCell(0);
+
+                // The back edge is taken while the budget lasts, running out falls through to the refill
+                if(limited)
+                {
+
+                    Assembler::Label exitJump = assembler.jumpIfZero();
+                    assembler.spendOne();
+                    assembler.patch(assembler.jumpIfNoBorrow(),loopStack.top().second);
+                    refill();
+                    assembler.patch(assembler.jump(),loopStack.top().second);
+                    assembler.patch(exitJump,assembler.position());
+
+                }
+
+                else
+                    assembler.patch(assembler.jumpIfNonZero(),loopStack.top().second);
+
+                assembler.patch(loopStack.top().first,assembler.position());
+                loopStack.pop();
+
+            }
+
+            break;
+
+        // Only the lowered code splits wide operands, here they are whole either way
+        case OPmulAdd:
+        case OPmulAddZero:
+        case OPmulAddWide:
+        case OPmulAddZeroWide:
+
+            {
+
+                std::int32_t source = cellDisp(offset);
+                std::int32_t target = cellDisp(offset + instr.parameter);
+                // Target may have forced materialization
+                source = cellDisp(offset);
+
+                assembler.loadCell(source);
+                assembler.testEax();
+                Assembler::Label skip = assembler.jumpIfZero();
+                assembler.mulEax(instr.parameter2);
+                assembler.addEaxToCell(target);
+
+                if(instr.opcode == OPmulAddZero || instr.opcode == OPmulAddZeroWide)
+                    assembler.setCell(source,0);
+
+                assembler.patch(skip,assembler.position());
+
+            }
+
+            break;
+
+        case OPproduct:
+
+            {
+
+                std::int32_t source = cellDisp(offset);
+                std::int32_t target = cellDisp(offset + lowHalf(instr.parameter));
+                std::int32_t other = cellDisp(offset + highHalf(instr.parameter));
+                // Later displacements may have forced materialization
+                source = cellDisp(offset);
+                target = cellDisp(offset + lowHalf(instr.parameter));
+
+                assembler.loadCell(source);
+                assembler.testEax();
+                Assembler::Label skip = assembler.jumpIfZero();
+                assembler.loadCellEcx(other);
+                assembler.mulEaxEcx();
+                assembler.mulEax(instr.parameter2);
+                assembler.addEaxToCell(target);
+                assembler.patch(skip,assembler.position());
+
+            }
+
+            break;
+
+        case OPsetZero:
+
+            assembler.setCell(cellDisp(offset),0);
+
+            break;
+
+        case OPfindZero:
+
+            {
+
+                // The vectorized scan only pays off when the current cell is nonzero
+                materialize();
+                assembler.testCell(0);
+                Assembler::Label skip = assembler.jumpIfZero();
+                assembler.pointerArg();
+                assembler.signedImmArg2(instr.parameter);
+                assembler.callContext(findZeroSlot);
+
+                if(limited)
+                {
+
+                    const std::int64_t stride = instr.parameter * cellSize;
+
+                    if(stride != static_cast<std::int32_t>(stride))
+                        throw std::runtime_error("Offset too large for the JIT");
+
+                    assembler.pointerFromScan(static_cast<std::int32_t>(stride));
+                    assembler.backEdgesFromCount();
+                    assembler.spendEax();
+                    refillWhenShort();
+
+                }
+
+                else
+                    assembler.pointerFromResult();
+
+                assembler.patch(skip,assembler.position());
+
+            }
+
+            break;
+
+        case OPtripCount:
+
+            {
+
+                const std::int32_t counter = cellDisp(offset);
+
+                // A counter stepping by -1 is its own count, limited runs still spend it
+                if(instr.parameter != -1)
+                {
+
+                    assembler.cellAddressArg1(counter);
+                    assembler.immArg2(instr.parameter);
+                    assembler.callContext(tripCountSlot);
+                    assembler.testResult();
+                    Assembler::Label done = assembler.jumpIfNonZero();
+
+                    // The loop never ends, with limits every turn is one of its iterations
+                    Assembler::Label hang = assembler.position();
+
+                    if(limited)
+                    {
+
+                        assembler.spendOne();
+                        refillWhenShort();
+
+                    }
+
+                    assembler.patch(assembler.jump(),hang);
+                    assembler.patch(done,assembler.position());
+
+                }
+
+                // The counter holds the number of iterations now
+                if(limited)
+                {
+
+                    assembler.loadCell(counter);
+                    assembler.backEdgesFromCount();
+                    assembler.spendEax();
+                    refillWhenShort();
+
+                }
+
+            }
+
+            break;
+
+        case OPwrite:
+
+            assembler.contextArg();
+            assembler.callContext(writeSlot);
+
+            break;
+
+        case OPloadTape:
+
+            assembler.cellAddressArg2(cellDisp(offset));
+            assembler.contextArg();
+            assembler.callContext(loadTapeSlot);
+
+            break;
+
+        case OPprint:
+
+            assembler.cellValueArg2(cellDisp(offset));
+            assembler.contextArg();
+            assembler.callContext(printSlot);
+
+            break;
+
+        case OPread:
+
+            assembler.cellAddressArg2(cellDisp(offset));
+            assembler.contextArg();
+            assembler.callContext(readSlot);
+
+            break;
+
+        case OPdebug:
+
+            assembler.cellAddressArg3(cellDisp(offset));
+            assembler.immArg2(instr.parameter);
+            assembler.contextArg();
+            assembler.callContext(debugSlot);
+
+            break;
+
+        case OPend:
+
+            assembler.epilogue();
+
+            break;
+
+        }
+
+    }
+
+    if(loop)
+    {
+
+        materialize();
+
+        if(limited)
+            assembler.storeBudget(budgetSlot);
+
+        assembler.returnPointer();
+        assembler.epilogue();
+
+    }
+
+    return assembler.code();
+
+}
+
+
+template <typename CellType>
+void Interpreter::compileJit()
+{
+
+    mNativeCode = std::make_shared<const NativeCode>(generateNative<CellType>(0,mCode.size(),false));
+
+}
+
+
+// Runs the native code of compileJit on the given tape, input and output
+template <typename CellType>
+void Interpreter::executeCodeJit(InputSource &input,OutputSink &output,Tape &tape,RunState &state) const
+{
+
+    JitContext context;
+    initContext<CellType>(context,input,output,tape,tripCountCell<CellType>,mPrefixOutput,mPrefixTape,state.debugger,state.watchdog);
+
+    using JitFunction = void (*)(void *cells,JitContext *context);
+    JitFunction function;
+
+    // Object pointer to function pointer conversion is only conditionally supported
+    static_assert(sizeof(function) == sizeof(void *),"Function pointers must fit in void*");
+    void *entry = mNativeCode->memory();
+    std::memcpy(&function,&entry,sizeof(function));
+
+    if(sigsetjmp(tape.arm(),1))
+    {
+
+        // The watchdog stops a run the same way
+        if(state.watchdog && state.watchdog->exceeded())
+            throw LimitExceeded(state.watchdog->exceeded());
+
+        throw std::runtime_error("Tape overflow");
+
+    }
+
+    if(state.watchdog)
+        context.budget = state.watchdog->refill(0);
+
+    function(context.cells,&context);
+    output.flush();
+
+}
+
+
+Interpreter::LoopCompiler::LoopCompiler(const Interpreter &interpreter,InputSource &input,OutputSink &output,Tape &tape,Debugger *debugger,
+                                        Watchdog *watchdog)
+    :mInterpreter(interpreter),mEntries(new std::atomic<LoopFunction>[interpreter.mCompactCode.size()]()),mStopped(false)
+{
+
+    std::shared_ptr<JitContext> context = std::make_shared<JitContext>();
+    const std::string &prefixOutput = interpreter.mPrefixOutput;
+    const std::vector <std::uint64_t> &prefixTape = interpreter.mPrefixTape;
+
+    switch(interpreter.mOptions.cellBits)
+    {
+
+    case 8:
+
+        initContext<std::uint8_t>(*context,input,output,tape,tripCountCell<std::uint8_t>,prefixOutput,prefixTape,debugger,watchdog);
+
+        break;
+
+    case 16:
+
+        initContext<std::uint16_t>(*context,input,output,tape,tripCountCell<std::uint16_t>,prefixOutput,prefixTape,debugger,watchdog);
+
+        break;
+
+    case 32:
+
+        initContext<std::uint32_t>(*context,input,output,tape,tripCountCell<std::uint32_t>,prefixOutput,prefixTape,debugger,watchdog);
+
+        break;
+
+    case 64:
+
+        initContext<std::uint64_t>(*context,input,output,tape,tripCountCell<std::uint64_t>,prefixOutput,prefixTape,debugger,watchdog);
+
+        break;
+
+    }
+
+    mContext = context;
+
+}
+
+
+Interpreter::LoopCompiler::~LoopCompiler()
+{
+
+    {
+
+        std::lock_guard <std::mutex> lock(mMutex);
+        mStopped = true;
+
+    }
+
+    mWake.notify_one();
+
+    if(mThread.joinable())
+        mThread.join();
+
+}
+
+
+void Interpreter::LoopCompiler::submit(std::size_t loop)
+{
+
+    {
+
+        std::lock_guard <std::mutex> lock(mMutex);
+        mQueue.push_back(loop);
+
+        if(!mThread.joinable())
+            mThread = std::thread(&LoopCompiler::run,this);
+
+    }
+
+    mWake.notify_one();
+
+}
+
+
+void Interpreter::LoopCompiler::run()
+{
+
+    while(true)
+    {
+
+        std::size_t loop;
+
+        {
+
+            std::unique_lock <std::mutex> lock(mMutex);
+            mWake.wait(lock,[&]() { return !mQueue.empty() || mStopped; });
+
+            if(mStopped)
+                return;
+
+            loop = mQueue.front();
+            mQueue.pop_front();
+
+        }
+
+        if(mEntries[loop].load(std::memory_order_relaxed))
+            continue;
+
+        // A loop that can not be translated stays in the interpreter
+        try
+        {
+
+            mEntries[loop].store(compile(loop),std::memory_order_release);
+
+        }
+        catch(const std::exception &)
+        {}
+
+    }
+
+}
+
+
+void *Interpreter::LoopCompiler::call(LoopFunction loop,void *cell,std::uint64_t &budget)
+{
+
+    JitContext *context = static_cast<JitContext *>(mContext.get());
+
+    context->budget = budget;
+    void *end = loop(cell,context);
+    budget = context->budget;
+
+    return end;
+
+}
+
+
+Interpreter::LoopFunction Interpreter::LoopCompiler::compile(std::size_t loop)
+{
+
+    const Code &code = mInterpreter.mCode;
+
+    // jumpOnZero in mCode of the loop ending at every jumpOnNonZero of mCompactCode
+    if(mLoopStart.empty())
+    {
+
+        mLoopStart.resize(mInterpreter.mCompactCode.size());
+
+        for(std::size_t i = 0; i < code.size(); ++i)
+            if(code[i].opcode == OPjumpOnNonZero)
+                mLoopStart[mInterpreter.mLoweredIndex[i]] = code[i].parameter;
+
+    }
+
+    const std::size_t begin = mLoopStart[loop];
+    const std::size_t end = code[begin].parameter + 1;
+    std::vector <std::uint8_t> native;
+
+    switch(mInterpreter.mOptions.cellBits)
+    {
+
+    case 8:
+
+        native = mInterpreter.generateNative<std::uint8_t>(begin,end,true);
+
+        break;
+
+    case 16:
+
+        native = mInterpreter.generateNative<std::uint16_t>(begin,end,true);
+
+        break;
+
+    case 32:
+
+        native = mInterpreter.generateNative<std::uint32_t>(begin,end,true);
+
+        break;
+
+    case 64:
+
+        native = mInterpreter.generateNative<std::uint64_t>(begin,end,true);
+
+        break;
+
+    }
+
+    mNativeCode.push_back(std::make_shared<const NativeCode>(native));
+
+    LoopFunction function;
+    void *entry = mNativeCode.back()->memory();
+    std::memcpy(&function,&entry,sizeof(function));
+
+    return function;
+
+}
+
+#else
+
+template <typename CellType>
+void Interpreter::compileJit()
+{
+
+    throw std::runtime_error("JIT is not supported on this platform");
+
+}
+
+template <typename CellType>
+void Interpreter::executeCodeJit(InputSource &,OutputSink &,Tape &,RunState &) const
+{
+
+    throw std::runtime_error("JIT is not supported on this platform");
+
+}
+
+template <typename CellType>
+std::vector <std::uint8_t> Interpreter::generateNative(std::size_t,std::size_t,bool) const
+{
+
+    throw std::runtime_error("JIT is not supported on this platform");
+
+}
+
+
+Interpreter::LoopCompiler::LoopCompiler(const Interpreter &interpreter,InputSource &,OutputSink &,Tape &,Debugger *,Watchdog *)
+    :mInterpreter(interpreter),mEntries(new std::atomic<LoopFunction>[interpreter.mCompactCode.size()]()),mStopped(false)
+{}
+
+
+Interpreter::LoopCompiler::~LoopCompiler()
+{}
+
+
+void Interpreter::LoopCompiler::submit(std::size_t)
+{}
+
+
+void *Interpreter::LoopCompiler::call(LoopFunction,void *,std::uint64_t &)
+{
+
+    throw std::runtime_error("JIT is not supported on this platform");
+
+}
+
+#endif
+
+template void Interpreter::compileJit<std::uint8_t>();
+template void Interpreter::compileJit<std::uint16_t>();
+template void Interpreter::compileJit<std::uint32_t>();
+template void Interpreter::compileJit<std::uint64_t>();
+template void Interpreter::executeCodeJit<std::uint8_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+template void Interpreter::executeCodeJit<std::uint16_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+template void Interpreter::executeCodeJit<std::uint32_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+template void Interpreter::executeCodeJit<std::uint64_t>(InputSource &,OutputSink &,Tape &,RunState &) const;
+template std::vector <std::uint8_t> Interpreter::generateNative<std::uint8_t>(std::size_t,std::size_t,bool) const;
+template std::vector <std::uint8_t> Interpreter::generateNative<std::uint16_t>(std::size_t,std::size_t,bool) const;
+template std::vector <std::uint8_t> Interpreter::generateNative<std::uint32_t>(std::size_t,std::size_t,bool) const;
+template std::vector <std::uint8_t> Interpreter::generateNative<std::uint64_t>(std::size_t,std::size_t,bool) const;
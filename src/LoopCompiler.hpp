@@ -0,0 +1,67 @@
+#ifndef LOOP_COMPILER_HPP
+#define LOOP_COMPILER_HPP
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include "Interpreter.hpp"
+
+/*
+
+Background compiler of a tiered run. The interpreter submits the loops whose back
+edge got hot, a thread of its own translates each one to native code and publishes
+its entry. The interpreter picks the entry up at the next back edge or entry of the
+loop, the loop then runs natively until it ends. The thread starts with the first
+loop submitted, short runs never pay for it. Without JIT support nothing is
+ever published and the run stays in the interpreter.
+
+*/
+class Interpreter::LoopCompiler
+{
+
+public:
+
+    LoopCompiler(const Interpreter &interpreter,InputSource &input,OutputSink &output,Tape &tape,Debugger *debugger,Watchdog *watchdog);
+    // Waits for the loop being compiled, the rest of the queue is dropped
+    ~LoopCompiler();
+
+    LoopCompiler(const LoopCompiler &) = delete;
+    LoopCompiler &operator=(const LoopCompiler &) = delete;
+
+    // loop is the index of the loop's OPjumpOnNonZero in mCompactCode
+    void submit(std::size_t loop);
+
+    // Native code of the loop, null until it is compiled
+    LoopFunction entry(std::size_t loop) const { return mEntries[loop].load(std::memory_order_acquire); }
+    // Runs the native code of a loop from cell, the loop spends its steps from budget
+    void *call(LoopFunction loop,void *cell,std::uint64_t &budget);
+
+private:
+
+    void run();
+    LoopFunction compile(std::size_t loop);
+
+    const Interpreter &mInterpreter;
+    std::unique_ptr<std::atomic<LoopFunction>[]> mEntries;
+    // JitContext of the run, passed to every loop
+    std::shared_ptr<void> mContext;
+
+    // Only touched by the compiler thread
+    std::vector <std::size_t> mLoopStart;
+    std::vector <std::shared_ptr<const NativeCode>> mNativeCode;
+
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::deque <std::size_t> mQueue;
+    bool mStopped;
+    std::thread mThread;
+
+};
+
+#endif
@@ -1,13 +1,22 @@
 #include "Interpreter.hpp"
-#include <fstream>
+#include "Program.hpp"
+#include "Execution.hpp"
+#include "Batch.hpp"
+#include "Watchdog.hpp"
 #include <iostream>
 #include <iomanip>
-#include <sstream>
 #include <cstddef>
+#include <cstdint>
+#include <cmath>
 #include <string>
 #include <memory>
 #include <utility>
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
+
+// Exit status of a run stopped by --max-steps or --timeout, the one timeout(1) uses
+const int limitExceededStatus = 124;
 
 class Bf
 {
@@ -16,7 +25,8 @@ public:
 
 	enum class InputType {stdin, file, string};
 
-    Bf():mArraySize(10000),mDebug(false),mHelp(false),inputType(InputType::stdin)
+    Bf():mHelp(false),inputType(InputType::stdin),mFlushPolicy(OutputSink::defaultPolicy()),mDelimiter('\n'),
+        mThreads(std::max(std::thread::hardware_concurrency(),1u))
     {}
 
     void run(int argc,char *argv[])
@@ -30,11 +40,52 @@ public:
         else
         {
 
-            Interpreter interpreter;
-            if(inputType == InputType::stdin)
-            	interpreter.run(mSourceFile,std::cin,mArraySize,mDebug);
+            if(!mEmitFile.empty())
+            {
+
+                Interpreter interpreter;
+                interpreter.emitC(*mSourceFile,mOptions,mEmitFile);
+
+            }
+
+            else if(!mBatchPath.empty())
+            {
+
+                std::unique_ptr<Batch> batch = Batch::open(mBatchPath,mDelimiter);
+                Program program(*mSourceFile,mOptions);
+
+                const Batch::Summary summary = batch->run(program,mThreads,std::cout,std::cerr);
+
+                if(summary.failed)
+                {
+
+                    const std::string message = std::to_string(summary.failed) + " of " + std::to_string(batch->size()) + " records failed";
+
+                    // A record over its limit gives the batch the exit status of a single run
+                    if(summary.limited)
+                        throw LimitExceeded(message);
+
+                    throw std::runtime_error(message);
+
+                }
+
+            }
+
             else
-            	interpreter.run(mSourceFile,*mStdin,mArraySize,mDebug);
+            {
+
+                Program program(*mSourceFile,mOptions);
+                Execution execution(program,std::move(mStdin),std::unique_ptr<OutputSink>(new OutputSink(mFlushPolicy)));
+
+                if(!mDebugInput.empty())
+                    execution.setDebugControl(InputSource::openFile(mDebugInput));
+
+                execution.run();
+
+                if(mOptions.profile)
+                    execution.reportProfile(std::cerr);
+
+            }
 
         }
 
@@ -64,6 +115,51 @@ private:
     }
 
 
+    // Positive whole number of steps
+    bool strToSteps(const std::string &str,std::uint64_t &n)
+    {
+
+        if(str.empty() || str.find_first_not_of("0123456789") != std::string::npos)
+            return false;
+
+        try
+        {
+
+            n = std::stoull(str);
+
+        }
+        catch(...)
+        {
+            return false;
+        }
+
+        return n > 0;
+
+    }
+
+
+    // Positive number of seconds, fractions allowed
+    bool strToSeconds(const std::string &str,double &seconds)
+    {
+
+        std::size_t end = 0;
+
+        try
+        {
+
+            seconds = std::stod(str,&end);
+
+        }
+        catch(...)
+        {
+            return false;
+        }
+
+        return end == str.size() && std::isfinite(seconds) && seconds > 0;
+
+    }
+
+
     void displayHelp()
     {
 
@@ -72,8 +168,37 @@ private:
 
             { "-i <input>","Specify input"},
             { "-f <filename>", "Specify file as input"},
-            { "-d","Enable debug mode"},
-            { "-s","Specify array size"}
+            { "-d","Enable debug mode, stop at '#' and breakpoints"},
+            { "--break <offset>","Stop before the first command at or after the source offset,"},
+            { "","enables debug mode"},
+            { "--debug-input <file>","Read debugger commands from file instead of /dev/tty"},
+            { "-s","Specify array size (cells on each side of the start)"},
+            { "-c <bits>","Specify cell size (8, 16, 32, 64), default 32"},
+            { "-e <engine>","Specify execution engine (switch, threaded, jit, tiered)"},
+            { "--jit","Compile to native code, same as -e jit"},
+            { "--huge-pages","Back the tape with transparent huge pages"},
+            { "--emit-c <file>","Write the program as C source instead of running it"},
+            { "--profile","Count executed instructions and print hot loops to stderr"},
+            { "","(runs on the switch engine)"},
+            { "-O<level>","Optimization level (0, 1, 2, 3), default 3"},
+            { "--enable <pass>","Run the pass at any optimization level"},
+            { "--disable <pass>","Skip the pass at any optimization level"},
+            { "","(" + Interpreter::passNames() + ")"},
+            { "--time-passes","Print time and instruction count of every pass to stderr"},
+            { "--verify-folds","Check every folded nested loop against the loop while compiling"},
+            { "--cache <dir>","Keep the optimized program in dir and reuse it on later runs"},
+            { "--flush <policy>","Flush output after every byte, line, full buffer or at exit,"},
+            { "","or from a writer thread (byte, line, full, exit, async),"},
+            { "","default line on terminal, full otherwise"},
+            { "--batch <path>","Run once for every file of a directory or record of a file,"},
+            { "","outputs are written in input order"},
+            { "--delimiter <char>","Record delimiter of a batch file (\\n, \\t, \\0 or a character),"},
+            { "","default newline"},
+            { "-j <threads>","Number of batch workers, default one per hardware thread"},
+            { "--max-steps <n>","Stop a run after n taken loop back edges, the same at every"},
+            { "","optimization level, exit status " + std::to_string(limitExceededStatus)},
+            { "--timeout <seconds>","Stop a run that takes longer, compile time not included,"},
+            { "","exit status " + std::to_string(limitExceededStatus)}
 
         };
 
@@ -82,7 +207,7 @@ private:
         std::cout << "options: \n";
 
         for(const auto &option : options)
-            std::cout << std::setw(20) << std::left << option[0] << option[1]<<"\n";
+            std::cout << std::setw(22) << std::left << option[0] << option[1]<<"\n";
 
         std::cout << "NOTE: If you specify multiple options the last one will be used\n";
 
@@ -102,7 +227,233 @@ private:
         for(int i = 1; i < argc; ++i)
         {
 
-            if(argv[i][0] == '-' && argv[i][2] == '\0')
+            if(argv[i][0] == '-' && argv[i][1] == '-')
+            {
+
+                std::string option = argv[i];
+
+                if(option == "--jit")
+                    mOptions.engine = Interpreter::Engine::jit;
+
+                else if(option == "--huge-pages")
+                    mOptions.hugePages = true;
+
+                else if(option == "--profile")
+                    mOptions.profile = true;
+
+                else if(option == "--time-passes")
+                    mOptions.timePasses = true;
+
+                else if(option == "--verify-folds")
+                    mOptions.verifyFolds = true;
+
+                else if(option == "--enable" || option == "--disable")
+                {
+
+                    if(i + 1 < argc)
+                    {
+
+                        std::string pass = argv[++i];
+
+                        if(!Interpreter::validPass(pass))
+                            throw std::runtime_error("Unknown pass " + pass);
+
+                        // The last one given for a pass wins
+                        if(option == "--enable")
+                        {
+
+                            mOptions.enabledPasses.insert(pass);
+                            mOptions.disabledPasses.erase(pass);
+
+                        }
+
+                        else
+                        {
+
+                            mOptions.disabledPasses.insert(pass);
+                            mOptions.enabledPasses.erase(pass);
+
+                        }
+
+                    }
+                    else
+                        throw std::runtime_error("Missing pass after '" + option + "'");
+
+                }
+
+                else if(option == "--flush")
+                {
+
+                    if(i + 1 < argc)
+                    {
+
+                        std::string policy = argv[++i];
+
+                        if(policy == "byte")
+                            mFlushPolicy = OutputSink::FlushPolicy::byte;
+
+                        else if(policy == "line")
+                            mFlushPolicy = OutputSink::FlushPolicy::line;
+
+                        else if(policy == "full")
+                            mFlushPolicy = OutputSink::FlushPolicy::full;
+
+                        else if(policy == "exit")
+                            mFlushPolicy = OutputSink::FlushPolicy::exit;
+
+                        else if(policy == "async")
+                            mFlushPolicy = OutputSink::FlushPolicy::async;
+
+                        else
+                            throw std::runtime_error("Invalid flush policy " + policy);
+
+                    }
+                    else
+                        throw std::runtime_error("Missing policy after '--flush'");
+
+                }
+
+                else if(option == "--break")
+                {
+
+                    if(i + 1 < argc)
+                    {
+
+                        int offset;
+
+                        if(!strToInt(argv[++i],offset) || offset < 0)
+                            throw std::runtime_error(std::string("Invalid source offset ") + argv[i]);
+
+                        mOptions.breakpoints.insert(offset);
+                        mOptions.debugMode = true;
+
+                    }
+                    else
+                        throw std::runtime_error("Missing source offset after '--break'");
+
+                }
+
+                else if(option == "--debug-input")
+                {
+
+                    if(i + 1 < argc)
+                        mDebugInput = argv[++i];
+
+                    else
+                        throw std::runtime_error("Missing filename after '--debug-input'");
+
+                }
+
+                else if(option == "--cache")
+                {
+
+                    if(i + 1 < argc)
+                        mOptions.cacheDir = argv[++i];
+
+                    else
+                        throw std::runtime_error("Missing directory after '--cache'");
+
+                }
+
+                else if(option == "--batch")
+                {
+
+                    if(i + 1 < argc)
+                        mBatchPath = argv[++i];
+
+                    else
+                        throw std::runtime_error("Missing path after '--batch'");
+
+                }
+
+                else if(option == "--delimiter")
+                {
+
+                    if(i + 1 < argc)
+                    {
+
+                        const std::string delimiter = argv[++i];
+
+                        if(delimiter == "\\n")
+                            mDelimiter = '\n';
+
+                        else if(delimiter == "\\t")
+                            mDelimiter = '\t';
+
+                        else if(delimiter == "\\0")
+                            mDelimiter = '\0';
+
+                        else if(delimiter.size() == 1)
+                            mDelimiter = delimiter[0];
+
+                        else
+                            throw std::runtime_error("Invalid delimiter " + delimiter);
+
+                    }
+                    else
+                        throw std::runtime_error("Missing delimiter after '--delimiter'");
+
+                }
+
+                else if(option == "--max-steps")
+                {
+
+                    if(i + 1 < argc)
+                    {
+
+                        if(!strToSteps(argv[++i],mOptions.maxSteps))
+                            throw std::runtime_error(std::string("Invalid step count ") + argv[i]);
+
+                    }
+                    else
+                        throw std::runtime_error("Missing step count after '--max-steps'");
+
+                }
+
+                else if(option == "--timeout")
+                {
+
+                    if(i + 1 < argc)
+                    {
+
+                        if(!strToSeconds(argv[++i],mOptions.timeout))
+                            throw std::runtime_error(std::string("Invalid timeout ") + argv[i]);
+
+                    }
+                    else
+                        throw std::runtime_error("Missing seconds after '--timeout'");
+
+                }
+
+                else if(option == "--emit-c")
+                {
+
+                    if(i + 1 < argc)
+                        mEmitFile = argv[++i];
+
+                    else
+                        throw std::runtime_error("Missing filename after '--emit-c'");
+
+                }
+
+                else
+                    throw std::runtime_error("Invalid option " + option);
+
+            }
+
+            else if(argv[i][0] == '-' && argv[i][1] == 'O')
+            {
+
+                const char level = argv[i][2];
+
+                if(level < '0' || level > static_cast<char>('0' + Interpreter::maxOptLevel) || argv[i][3] != '\0')
+                    throw std::runtime_error(std::string("Invalid optimization level ") + argv[i]);
+
+                mOptions.optLevel = level - '0';
+
+            }
+
+            else if(argv[i][0] == '-' && argv[i][2] == '\0')
                 switch(argv[i][1])
                 {
 
@@ -136,7 +487,7 @@ private:
 
                 case 'd':
 
-                    mDebug = true;
+                    mOptions.debugMode = true;
 
                     break;
 
@@ -149,7 +500,7 @@ private:
                             throw std::runtime_error(std::string("Invalid size ") + argv[i]);
 
                         else
-                            mArraySize = arraySize;
+                            mOptions.arraySize = arraySize;
 
                     }
                     else
@@ -157,6 +508,72 @@ private:
 
                     break;
 
+                case 'e':
+
+                    if(i + 1 < argc)
+                    {
+
+                        std::string engine = argv[++i];
+
+                        if(engine == "switch")
+                            mOptions.engine = Interpreter::Engine::switchDispatch;
+
+                        else if(engine == "threaded")
+                            mOptions.engine = Interpreter::Engine::threaded;
+
+                        else if(engine == "jit")
+                            mOptions.engine = Interpreter::Engine::jit;
+
+                        else if(engine == "tiered")
+                            mOptions.engine = Interpreter::Engine::tiered;
+
+                        else
+                            throw std::runtime_error("Invalid engine " + engine);
+
+                    }
+                    else
+                        throw std::runtime_error("Missing engine after '-e'");
+
+                    break;
+
+                case 'c':
+
+                    if(i + 1 < argc)
+                    {
+
+                        int cellBits;
+
+                        if(!strToInt(argv[++i],cellBits) || cellBits <= 0 || !Interpreter::validCellBits(cellBits))
+                            throw std::runtime_error(std::string("Invalid cell size ") + argv[i]);
+
+                        else
+                            mOptions.cellBits = cellBits;
+
+                    }
+                    else
+                        throw std::runtime_error("Missing size after '-c'");
+
+                    break;
+
+                case 'j':
+
+                    if(i + 1 < argc)
+                    {
+
+                        int threads;
+
+                        if(!strToInt(argv[++i],threads) || threads <= 0)
+                            throw std::runtime_error(std::string("Invalid thread count ") + argv[i]);
+
+                        else
+                            mThreads = threads;
+
+                    }
+                    else
+                        throw std::runtime_error("Missing thread count after '-j'");
+
+                    break;
+
                 case 'h':
 
                     mHelp = true;
@@ -177,10 +594,7 @@ private:
             {
 
                 fileSpecified = true;
-                mSourceFile.open(argv[i]);
-
-                if(!mSourceFile.is_open())
-                    throw std::runtime_error(std::string("Could not open the file: ") + argv[i]);
+                mSourceFile.reset(new SourceFile(argv[i]));
 
             }
 
@@ -189,28 +603,40 @@ private:
         if(!fileSpecified)
             throw std::runtime_error("No input file specified");
 
-        if(inputType == InputType::file)
+        if(!mBatchPath.empty())
         {
 
-            std::unique_ptr<std::ifstream> stdin(new std::ifstream(stdinFilename));
-
-            if(!stdin->is_open())
-                throw std::runtime_error(std::string("Could not open the file: ") + stdinFilename);
+            if(inputType != InputType::stdin)
+                throw std::runtime_error("The input of a batch comes from its records, '-i' and '-f' can not be used");
 
-            mStdin = std::move(stdin);
+            // Both need the console and report a single run
+            if(mOptions.debugMode || mOptions.profile)
+                throw std::runtime_error("Debug mode and profiling can not be used with '--batch'");
 
         }
+
+        if(inputType == InputType::file)
+            mStdin = InputSource::openFile(stdinFilename);
+
         else if(inputType == InputType::string )
-            mStdin = std::unique_ptr<std::istream> (new std::istringstream(stdinString));
+            mStdin = InputSource::fromString(stdinString);
+
+        else
+            mStdin = InputSource::fromStdin();
 
     }
 
-    std::ifstream mSourceFile;
-    std::unique_ptr<std::istream> mStdin;
-    std::size_t mArraySize;
-    bool mDebug;
+    std::unique_ptr<SourceFile> mSourceFile;
+    std::unique_ptr<InputSource> mStdin;
+    std::string mEmitFile;
+    Interpreter::Options mOptions;
     bool mHelp;
     InputType inputType;
+    OutputSink::FlushPolicy mFlushPolicy;
+    std::string mBatchPath;
+    std::string mDebugInput;
+    char mDelimiter;
+    unsigned mThreads;
 
 };
 
@@ -218,12 +644,21 @@ private:
 int main(int argc,char *argv[])
 {
 
+    int status = 0;
+
     try
     {
 
         Bf bf;
         bf.run(argc,argv);
 
+    }
+    catch(const LimitExceeded &ex)
+    {
+
+        std::cerr << "Error: " << ex.what();
+        status = limitExceededStatus;
+
     }
     catch(const std::exception &ex)
     {
@@ -234,5 +669,5 @@ int main(int argc,char *argv[])
 
     std::cout << "\n";
 
-    return 0;
+    return status;
 }
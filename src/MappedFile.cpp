@@ -0,0 +1,44 @@
+#include "MappedFile.hpp"
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+MappedFile::MappedFile(int fd,std::size_t size):mSize(size)
+{
+
+    if(!mSize)
+        throw std::runtime_error("Can not map an empty file");
+
+    mData = mmap(nullptr,mSize,PROT_READ,MAP_PRIVATE,fd,0);
+
+    if(mData == MAP_FAILED)
+        throw std::runtime_error("Could not map the file");
+
+    // Files are always consumed front to back
+    madvise(mData,mSize,MADV_SEQUENTIAL);
+
+}
+
+
+MappedFile::~MappedFile()
+{
+
+    munmap(mData,mSize);
+
+}
+
+
+bool MappedFile::mappable(int fd,std::size_t &size)
+{
+
+    struct stat info;
+
+    if(fstat(fd,&info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0)
+        return false;
+
+    size = static_cast<std::size_t>(info.st_size);
+
+    return true;
+
+}
@@ -0,0 +1,32 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+
+// Read-only private mapping of a whole regular file
+class MappedFile
+{
+
+public:
+
+    // fd stays owned by the caller and may be closed after construction
+    MappedFile(int fd,std::size_t size);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const char *data() const { return static_cast<const char *>(mData); }
+    std::size_t size() const { return mSize; }
+
+    // Size of fd if it refers to a regular file that can be mapped
+    static bool mappable(int fd,std::size_t &size);
+
+private:
+
+    void *mData;
+    std::size_t mSize;
+
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "OutputSink.hpp"
+#include "AsyncWriter.hpp"
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <unistd.h>
+
+namespace
+{
+
+// Output the program can run ahead of the writer thread
+const std::size_t asyncRingSize = std::size_t(1) << 24;
+
+}
+
+
+OutputSink::FlushPolicy OutputSink::defaultPolicy()
+{
+
+    return isatty(STDOUT_FILENO) ? FlushPolicy::line : FlushPolicy::full;
+
+}
+
+
+OutputSink::OutputSink(FlushPolicy policy,std::size_t capacity)
+    :OutputSink(std::cout,policy,capacity)
+{}
+
+
+OutputSink::OutputSink(std::ostream &stream,FlushPolicy policy,std::size_t capacity)
+    :mStream(stream),mPolicy(policy),mSize(0),mLimit(policy == FlushPolicy::byte ? 1 : capacity),mChunk(capacity)
+{
+
+    if(policy == FlushPolicy::async)
+    {
+
+        if(&stream != &std::cout)
+            throw std::runtime_error("Asynchronous output only writes to stdout");
+
+        // Anything buffered in cout goes first, the writer thread bypasses it
+        std::cout.flush();
+        mWriter.reset(new AsyncWriter(STDOUT_FILENO,asyncRingSize));
+        mData = mWriter->reserve(capacity,mLimit);
+
+    }
+
+    else
+    {
+
+        mBuffer.resize(capacity);
+        mData = mBuffer.data();
+
+    }
+
+}
+
+
+OutputSink::~OutputSink()
+{
+
+    try
+    {
+
+        flush();
+
+    }
+    catch(...)
+    {
+    }
+
+}
+
+
+void OutputSink::write(const char *data,std::size_t size)
+{
+
+    // Both look at every byte
+    if(mPolicy == FlushPolicy::byte || mPolicy == FlushPolicy::line)
+    {
+
+        for(std::size_t i = 0; i < size; ++i)
+            put(data[i]);
+
+        return;
+
+    }
+
+    // Copied a reserved piece of the ring at a time
+    if(mPolicy == FlushPolicy::async)
+    {
+
+        while(size)
+        {
+
+            const std::size_t count = std::min(size,mLimit - mSize);
+
+            std::memcpy(mData + mSize,data,count);
+            mSize += count;
+            data += count;
+            size -= count;
+
+            if(mSize >= mLimit)
+                overflow();
+
+        }
+
+        return;
+
+    }
+
+    if(mSize + size > mBuffer.size())
+    {
+
+        if(mPolicy == FlushPolicy::exit)
+        {
+
+            mBuffer.resize((mSize + size) * 2);
+            mData = mBuffer.data();
+            mLimit = mBuffer.size();
+
+        }
+
+        else
+        {
+
+            flush();
+
+            // Does not fit even into the empty buffer
+            if(size >= mBuffer.size())
+            {
+
+                mStream.write(data,size);
+                return;
+
+            }
+
+        }
+
+    }
+
+    std::memcpy(mData + mSize,data,size);
+    mSize += size;
+
+    if(mSize >= mLimit)
+        overflow();
+
+}
+
+
+void OutputSink::flush()
+{
+
+    if(mWriter)
+    {
+
+        mWriter->commit(mSize);
+        mSize = 0;
+
+        // Same as a failed write to the stream
+        if(!mWriter->drain())
+            mStream.setstate(std::ios::badbit);
+
+        mData = mWriter->reserve(mChunk,mLimit);
+
+        return;
+
+    }
+
+    if(mSize)
+    {
+
+        mStream.write(mBuffer.data(),mSize);
+        mSize = 0;
+
+    }
+
+    mStream.flush();
+
+}
+
+
+void OutputSink::overflow()
+{
+
+    if(mWriter)
+    {
+
+        mWriter->commit(mSize);
+        mSize = 0;
+        mData = mWriter->reserve(mChunk,mLimit);
+
+    }
+
+    else if(mPolicy == FlushPolicy::exit && mSize == mBuffer.size())
+    {
+
+        mBuffer.resize(mBuffer.size() * 2);
+        mData = mBuffer.data();
+        mLimit = mBuffer.size();
+
+    }
+
+    else if(mPolicy != FlushPolicy::exit)
+        flush();
+
+}
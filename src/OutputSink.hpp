@@ -0,0 +1,78 @@
+#ifndef OUTPUT_SINK_HPP
+#define OUTPUT_SINK_HPP
+
+#include <vector>
+#include <memory>
+#include <iosfwd>
+#include <cstddef>
+
+class AsyncWriter;
+
+/*
+
+Buffers program output in user space and writes it to stdout, or any other stream,
+according to the selected flush policy. Pending output is always written before the program
+blocks on input and when the sink is destroyed. With the async policy the buffer is a ring
+that a writer thread drains to stdout, the program only waits for it when the ring is full.
+
+*/
+class OutputSink
+{
+
+public:
+
+    enum class FlushPolicy
+    {
+
+        byte, // After every byte
+        line, // On newline or full buffer
+        full, // On full buffer
+        exit, // Only when the program ends, the buffer grows as needed
+        async // On full buffer, to a ring written by a thread of its own, stdout only
+
+    };
+
+    // line when stdout is a terminal, full otherwise
+    static FlushPolicy defaultPolicy();
+
+    explicit OutputSink(FlushPolicy policy = defaultPolicy(),std::size_t capacity = 1 << 16);
+    explicit OutputSink(std::ostream &stream,FlushPolicy policy = FlushPolicy::full,std::size_t capacity = 1 << 16);
+    ~OutputSink();
+
+    OutputSink(const OutputSink &) = delete;
+    OutputSink &operator=(const OutputSink &) = delete;
+
+    void put(char ch)
+    {
+
+        mData[mSize++] = ch;
+
+        if(mSize >= mLimit || (ch == '\n' && mPolicy == FlushPolicy::line))
+            overflow();
+
+    }
+
+    // Same as put for every byte, but copies whole runs when the policy allows it
+    void write(const char *data,std::size_t size);
+
+    void flush();
+
+private:
+
+    void overflow();
+
+    std::ostream &mStream;
+    FlushPolicy mPolicy;
+    std::vector <char> mBuffer;
+    // Start of the buffer, the space reserved in the ring with the async policy
+    char *mData;
+    std::size_t mSize;
+    // Number of buffered bytes that triggers overflow
+    std::size_t mLimit;
+    // Most the async policy hands to the writer thread at once
+    std::size_t mChunk;
+    std::unique_ptr<AsyncWriter> mWriter;
+
+};
+
+#endif
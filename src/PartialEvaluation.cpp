@@ -0,0 +1,447 @@
+#include "Interpreter.hpp"
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+/*
+
+Instructions evaluated at compile time before the rest is left to the engines. Evaluating
+a step costs about ten times what running it does, so a program compiled for a single run
+only gets a short prefix. Code kept in the cache or emitted as C is reused, its prefix
+is paid for once.
+
+*/
+const std::uint64_t prefixStepBudget = std::uint64_t(1) << 16;
+const std::uint64_t reusedPrefixStepBudget = std::uint64_t(1) << 24;
+
+/*
+
+Tape of the evaluator. It only holds the cells touched so far and grows towards
+whichever side the program moves to, positions are relative to the starting cell.
+The first access to a cell after a checkpoint saves its value, so a rollback costs
+as much as the cells touched since and not the whole tape.
+
+*/
+template <typename CellType>
+class PrefixTape
+{
+
+public:
+
+    explicit PrefixTape(std::int64_t cells):mCells(cells),mFirst(0),mEpoch(1){}
+
+    // False for cells the real tape does not have
+    bool contains(std::int64_t position) const
+    {
+
+        return position >= -mCells && position < mCells;
+
+    }
+
+    CellType &operator[](std::int64_t position)
+    {
+
+        const std::int64_t size = static_cast<std::int64_t>(mValues.size());
+
+        if(position < mFirst)
+        {
+
+            const std::int64_t grow = mFirst - position + size;
+            mValues.insert(mValues.begin(),grow,0);
+            mEpochs.insert(mEpochs.begin(),grow,0);
+            mFirst -= grow;
+
+        }
+
+        else if(position >= mFirst + size)
+        {
+
+            mValues.resize(position - mFirst + size + 1,0);
+            mEpochs.resize(mValues.size(),0);
+
+        }
+
+        const std::size_t index = static_cast<std::size_t>(position - mFirst);
+
+        // Any access may write, the value before the first one is kept
+        if(mEpochs[index] != mEpoch)
+        {
+
+            mEpochs[index] = mEpoch;
+            mSaved.push_back(std::make_pair(position,mValues[index]));
+
+        }
+
+        return mValues[index];
+
+    }
+
+    // rollback returns to the tape as it is now
+    void checkpoint()
+    {
+
+        ++mEpoch;
+        mSaved.clear();
+
+    }
+
+    void rollback()
+    {
+
+        for(auto iter = mSaved.rbegin(); iter != mSaved.rend(); ++iter)
+            mValues[iter->first - mFirst] = iter->second;
+
+        checkpoint();
+
+    }
+
+    std::int64_t first() const { return mFirst; }
+    const std::vector <CellType> &values() const { return mValues; }
+
+private:
+
+    std::int64_t mCells;
+    std::int64_t mFirst;
+    std::vector <CellType> mValues;
+    // Checkpoint each cell was last saved in
+    std::vector <std::uint64_t> mEpochs;
+    std::uint64_t mEpoch;
+    // Positions and values before the first access since the checkpoint
+    std::vector <std::pair<std::int64_t,CellType>> mSaved;
+
+};
+
+}
+
+
+/*
+
+Runs the program from the all zero tape at compile time, up to the first instruction
+that reads input (or stops in the debugger), the end of the program or the step budget.
+The evaluated prefix is replaced with OPloadTape, which restores the tape it left behind,
+and OPwrite, which writes everything it printed at once.
+
+Evaluation can only stop on the top level, inside a loop the rest of the code would have to
+be entered in the middle. The entry of every top level loop is a checkpoint of the tape, and
+when evaluation has to stop inside a loop it rolls back to the last one. Instructions that would touch a
+cell outside the tape or never terminate stop the evaluation the same way, so the engines
+report them as before.
+
+*/
+template <typename CellType>
+void Interpreter::evaluatePrefix()
+{
+
+    struct State
+    {
+
+        std::size_t next;
+        std::int64_t pointer;
+        std::size_t outputSize;
+
+    };
+
+    std::vector <bool> topLevel(mCode.size());
+    int depth = 0;
+
+    for(std::size_t i = 0; i < mCode.size(); ++i)
+    {
+
+        // The closing jump of a top level loop is still inside it
+        topLevel[i] = depth == 0;
+        depth += (mCode[i].opcode == OPjumpOnZero) - (mCode[i].opcode == OPjumpOnNonZero);
+
+    }
+
+    State state = {0,0,0};
+    State loopEntry = state;
+    PrefixTape<CellType> tape(mOptions.arraySize);
+    std::string output;
+    std::uint64_t steps = 0;
+    const std::uint64_t budget = mCodeReused ? reusedPrefixStepBudget : prefixStepBudget;
+
+    while(true)
+    {
+
+        const Instruction &instr = mCode[state.next];
+        const std::int64_t position = state.pointer + instr.parameter3;
+        // Instructions that would leave the tape are left to the engines
+        bool stop = ++steps > budget || !tape.contains(position);
+
+        if(topLevel[state.next] && instr.opcode == OPjumpOnZero)
+        {
+
+            loopEntry = state;
+            tape.checkpoint();
+
+        }
+
+        if(!stop)
+            switch(instr.opcode)
+            {
+
+            case OPeditVal:
+            case OPsetZero:
+            case OPprint:
+            case OPmovePtr:
+
+                break;
+
+            case OPmulAdd:
+            case OPmulAddZero:
+
+                stop = CellType(tape[position] + instr.parameter4) && !tape.contains(position + instr.parameter);
+
+                break;
+
+            case OPproduct:
+
+                stop = CellType(tape[position] + instr.parameter4)
+                       && (!tape.contains(position + lowHalf(instr.parameter)) || !tape.contains(position + highHalf(instr.parameter)));
+
+                break;
+
+            case OPjumpOnZero:
+            case OPjumpOnNonZero:
+            case OPfindZero:
+            case OPtripCount:
+
+                break;
+
+            default:
+
+                // Input, the debugger, the end of the program and anything not known here
+                stop = true;
+
+                break;
+
+            }
+
+        if(stop)
+        {
+
+            if(!topLevel[state.next])
+            {
+
+                state = loopEntry;
+                tape.rollback();
+
+            }
+
+            break;
+
+        }
+
+        CellType &cell = tape[position];
+        cell += instr.parameter4;
+
+        switch(instr.opcode)
+        {
+
+        case OPeditVal:
+
+            cell += instr.parameter;
+
+            break;
+
+        case OPsetZero:
+
+            cell = 0;
+
+            break;
+
+        case OPprint:
+
+            output.resize(state.outputSize);
+            output.push_back(static_cast<char>(cell));
+            ++state.outputSize;
+
+            break;
+
+        case OPmovePtr:
+
+            state.pointer += instr.parameter;
+
+            break;
+
+        case OPmulAdd:
+        case OPmulAddZero:
+
+            if(CellType value = cell)
+                tape[position + instr.parameter] += multiply(value,instr.parameter2);
+
+            if(instr.opcode == OPmulAddZero)
+                tape[position] = 0;
+
+            break;
+
+        case OPproduct:
+
+            // Growing the tape moves the cells, read both factors first
+            if(CellType value = cell)
+            {
+
+                value = multiply(multiplyCells(value,tape[position + highHalf(instr.parameter)]),instr.parameter2);
+                tape[position + lowHalf(instr.parameter)] += value;
+
+            }
+
+            break;
+
+        case OPjumpOnZero:
+
+            state.pointer = position;
+
+            if(!cell)
+            {
+
+                state.next = instr.parameter + 1;
+                continue;
+
+            }
+
+            break;
+
+        case OPjumpOnNonZero:
+
+            state.pointer = position;
+
+            if(cell)
+            {
+
+                state.next = instr.parameter + 1;
+                continue;
+
+            }
+
+            break;
+
+        case OPfindZero:
+
+            state.pointer = position;
+
+            while(!stop && tape[state.pointer])
+            {
+
+                state.pointer += instr.parameter;
+                stop = ++steps > budget || !tape.contains(state.pointer);
+
+            }
+
+            break;
+
+        case OPtripCount:
+
+            // The loop never ends, neither would the evaluation
+            stop = !tripCount(cell,instr.parameter);
+
+            break;
+
+        default:
+            break;
+
+        }
+
+        if(stop)
+        {
+
+            // The instruction has changed the state already
+            state = loopEntry;
+            tape.rollback();
+            break;
+
+        }
+
+        ++state.next;
+
+    }
+
+    if(state.next == 0)
+        return;
+
+    const std::vector <CellType> &values = tape.values();
+    std::size_t first = 0;
+    std::size_t last = values.size();
+
+    while(first < last && !values[first])
+        ++first;
+
+    while(last > first && !values[last - 1])
+        --last;
+
+    mPrefixOutput.assign(output,0,state.outputSize);
+    mPrefixTape.assign(values.begin() + first,values.begin() + last);
+
+    // At most an OPloadTape and an OPwrite
+    Code prefix;
+
+    // The rest of the program only needs the tape when it does more than end
+    if(!mPrefixTape.empty() && mCode[state.next].opcode != OPend)
+    {
+
+        Instruction instr(OPloadTape);
+        instr.parameter3 = static_cast<decltype(instr.parameter3)>(tape.first() + first);
+        prefix.push_back(instr);
+
+    }
+
+    else
+        mPrefixTape.clear();
+
+    if(!mPrefixOutput.empty())
+        prefix.push_back(Instruction(OPwrite));
+
+    // Jump targets move with the instructions
+    const std::int64_t shift = static_cast<std::int64_t>(prefix.size()) - static_cast<std::int64_t>(state.next);
+    bool blockEnded = false;
+
+    for(std::size_t i = state.next; i < mCode.size(); ++i)
+    {
+
+        Instruction &instr = mCode[i];
+
+        // The block evaluation stopped in starts at the pointer it left behind
+        if(!blockEnded)
+            instr.parameter3 += static_cast<decltype(instr.parameter3)>(state.pointer);
+
+        blockEnded |= endsBlock(instr.opcode);
+
+        if(instr.opcode == OPjumpOnZero || instr.opcode == OPjumpOnNonZero)
+            instr.parameter += static_cast<decltype(instr.parameter)>(shift);
+
+    }
+
+    // The evaluated instructions make room for the prefix
+    const std::size_t reused = std::min(prefix.size(),state.next);
+
+    std::copy(prefix.end() - reused,prefix.end(),mCode.begin() + (state.next - reused));
+    mCode.erase(mCode.begin(),mCode.begin() + (state.next - reused));
+    mCode.insert(mCode.begin(),prefix.begin(),prefix.end() - reused);
+
+    // The prefix stands for the start of the program
+    if(!mSourcePos.empty())
+    {
+
+        mSourcePos.erase(mSourcePos.begin(),mSourcePos.begin() + state.next);
+        mSourcePos.insert(mSourcePos.begin(),prefix.size(),0);
+
+    }
+
+    #if !defined(NDEBUG)
+
+    dumpCode("prefix.txt");
+
+    #endif
+
+}
+
+template void Interpreter::evaluatePrefix<std::uint8_t>();
+template void Interpreter::evaluatePrefix<std::uint16_t>();
+template void Interpreter::evaluatePrefix<std::uint32_t>();
+template void Interpreter::evaluatePrefix<std::uint64_t>();
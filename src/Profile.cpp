@@ -0,0 +1,153 @@
+#include "Interpreter.hpp"
+#include <ostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+// Loops listed in the report
+const std::size_t hotLoopCount = 20;
+// Source characters shown for every loop
+const std::size_t snippetSize = 40;
+
+struct LoopProfile
+{
+
+    std::int32_t sourcePos;
+    std::uint64_t entries;
+    std::uint64_t iterations;
+    // Instructions executed inside the loop, nested loops included
+    std::uint64_t instructions;
+
+};
+
+// Commands of the loop starting at position, shortened to snippetSize characters
+std::string loopSnippet(const std::string &source,std::size_t position)
+{
+
+    std::string snippet;
+    int depth = 0;
+
+    for(; position < source.size(); ++position)
+    {
+
+        const char ch = source[position];
+
+        if(std::string("+-<>[].,#").find(ch) == std::string::npos)
+            continue;
+
+        if(snippet.size() == snippetSize)
+            return snippet + "...";
+
+        snippet += ch;
+        depth += (ch == '[') - (ch == ']');
+
+        if(!depth)
+            break;
+
+    }
+
+    return snippet;
+
+}
+
+std::string percent(std::uint64_t part,std::uint64_t total)
+{
+
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(1) << (total ? 100.0 * part / total : 0.0) << "%";
+
+    return text.str();
+
+}
+
+}
+
+
+/*
+
+Prints what a profiling run counted. Loops are the ones left in the optimized code,
+anything the optimizer turned into straight-line code is not a loop anymore, so the
+hot loops are the patterns it could not handle. Loops are sorted by the instructions
+executed inside them and identified by the source offset of their '['.
+
+*/
+void Interpreter::reportProfile(const std::vector <std::uint64_t> &counts,std::ostream &out) const
+{
+
+    // Running sums, instructions before index i of mCompactCode
+    std::vector <std::uint64_t> before(counts.size() + 1,0);
+    std::vector <std::uint64_t> byOpcode(OPmulAddZeroWide + 1,0);
+
+    for(std::size_t i = 0; i < counts.size(); ++i)
+    {
+
+        before[i + 1] = before[i] + counts[i];
+        byOpcode[mCompactCode[i].opcode] += counts[i];
+
+    }
+
+    const std::uint64_t total = before.back();
+    std::vector <LoopProfile> loops;
+
+    for(std::size_t i = 0; i < mCode.size(); ++i)
+        if(mCode[i].opcode == OPjumpOnZero)
+        {
+
+            const std::int32_t begin = mLoweredIndex[i];
+            const std::int32_t end = mLoweredIndex[mCode[i].parameter];
+            const LoopProfile loop = {mSourcePos[i],counts[begin],counts[end],before[end + 1] - before[begin + 1]};
+
+            if(loop.entries)
+                loops.push_back(loop);
+
+        }
+
+    std::sort(loops.begin(),loops.end(),[](const LoopProfile &first,const LoopProfile &second)
+    {
+
+        return first.instructions > second.instructions;
+
+    });
+
+    if(loops.size() > hotLoopCount)
+        loops.resize(hotLoopCount);
+
+    const int columnW = 14;
+
+    out << "\nProfile: " << total << " instructions executed\n\n";
+    out << "Hot loops\n";
+    out << std::setw(columnW) << "source" << std::setw(columnW) << "entries" << std::setw(columnW) << "iterations"
+        << std::setw(columnW) << "instructions" << std::setw(columnW / 2 + 2) << "share" << "  code\n";
+
+    for(const auto &loop : loops)
+        out << std::setw(columnW) << loop.sourcePos << std::setw(columnW) << loop.entries << std::setw(columnW) << loop.iterations
+            << std::setw(columnW) << loop.instructions << std::setw(columnW / 2 + 2) << percent(loop.instructions,total)
+            << "  " << loopSnippet(mSource,loop.sourcePos) << "\n";
+
+    std::vector <std::size_t> opcodes;
+
+    for(std::size_t op = 0; op < byOpcode.size(); ++op)
+        if(byOpcode[op])
+            opcodes.push_back(op);
+
+    std::sort(opcodes.begin(),opcodes.end(),[&](std::size_t first,std::size_t second)
+    {
+
+        return byOpcode[first] > byOpcode[second];
+
+    });
+
+    out << "\nInstructions by opcode\n";
+
+    for(std::size_t op : opcodes)
+        out << "  " << std::left << std::setw(columnW) << opcodeName(static_cast<Opcode>(op)) << std::right << std::setw(columnW) << byOpcode[op]
+            << std::setw(columnW / 2 + 2) << percent(byOpcode[op],total) << "\n";
+
+}
@@ -0,0 +1,14 @@
+#include "Program.hpp"
+
+
+Program::Program(const char *source,std::size_t size,const Interpreter::Options &options)
+{
+
+    mInterpreter.compile(source,size,options);
+
+}
+
+
+Program::Program(const SourceFile &sourceFile,const Interpreter::Options &options)
+    :Program(sourceFile.data(),sourceFile.size(),options)
+{}
@@ -0,0 +1,39 @@
+#ifndef PROGRAM_HPP
+#define PROGRAM_HPP
+
+#include <cstddef>
+#include "Interpreter.hpp"
+#include "SourceFile.hpp"
+
+/*
+
+Compiled program, parsed and optimized once and run by any number of Executions.
+Nothing changes after construction, executions only read it and can run side by side.
+The engine and the cell size are part of the options it is compiled with.
+
+*/
+class Program
+{
+
+public:
+
+    Program(const char *source,std::size_t size,const Interpreter::Options &options);
+    Program(const SourceFile &sourceFile,const Interpreter::Options &options);
+
+    Program(const Program &) = delete;
+    Program &operator=(const Program &) = delete;
+
+    const Interpreter::Options &options() const { return mInterpreter.mOptions; }
+
+    // Time spent parsing and optimizing, execute is zero
+    const Interpreter::PhaseTimes &compileTimes() const { return mInterpreter.mPhaseTimes; }
+
+private:
+
+    friend class Execution;
+
+    Interpreter mInterpreter;
+
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include "SourceFile.hpp"
+#include <stdexcept>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+SourceFile::SourceFile(const std::string &filename)
+{
+
+    int fd = open(filename.c_str(),O_RDONLY);
+
+    if(fd < 0)
+        throw std::runtime_error("Could not open the file: " + filename);
+
+    std::size_t size;
+
+    try
+    {
+
+        if(MappedFile::mappable(fd,size))
+            mMapping.reset(new MappedFile(fd,size));
+
+        // Pipes and empty files are read in one go
+        else
+        {
+
+            char buffer[1 << 16];
+            ssize_t count;
+
+            while((count = read(fd,buffer,sizeof(buffer))) != 0)
+            {
+
+                if(count < 0 && errno != EINTR)
+                    throw std::runtime_error("Could not read the file: " + filename);
+
+                if(count > 0)
+                    mContents.append(buffer,count);
+
+            }
+
+        }
+
+    }
+    catch(...)
+    {
+
+        close(fd);
+        throw;
+
+    }
+
+    close(fd);
+
+    mData = mMapping ? mMapping->data() : mContents.data();
+    mSize = mMapping ? mMapping->size() : mContents.size();
+
+}
@@ -0,0 +1,32 @@
+#ifndef SOURCE_FILE_HPP
+#define SOURCE_FILE_HPP
+
+#include <memory>
+#include <string>
+#include <cstddef>
+#include "MappedFile.hpp"
+
+// Whole program source in memory, mapped when the file allows it
+class SourceFile
+{
+
+public:
+
+    explicit SourceFile(const std::string &filename);
+
+    SourceFile(const SourceFile &) = delete;
+    SourceFile &operator=(const SourceFile &) = delete;
+
+    const char *data() const { return mData; }
+    std::size_t size() const { return mSize; }
+
+private:
+
+    std::unique_ptr<MappedFile> mMapping;
+    std::string mContents;
+    const char *mData;
+    std::size_t mSize;
+
+};
+
+#endif
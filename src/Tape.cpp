@@ -0,0 +1,152 @@
+#include "Tape.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace
+{
+
+// Tape whose guard pages are watched on this thread
+thread_local Tape *activeTape = nullptr;
+
+struct sigaction previousAction;
+
+std::size_t roundToPages(std::size_t size)
+{
+
+    const std::size_t pageSize = sysconf(_SC_PAGESIZE);
+
+    return (size + pageSize - 1) / pageSize * pageSize;
+
+}
+
+}
+
+
+Tape::Tape(std::size_t cells,std::size_t cellSize,std::size_t guardCells,bool hugePages)
+{
+
+    const std::size_t minimumGuard = 1 << 16;
+    const std::size_t halfSize = roundToPages(cells * cellSize);
+
+    mGuardSize = roundToPages(guardCells * cellSize > minimumGuard ? guardCells * cellSize : minimumGuard);
+    mReservedSize = 2 * mGuardSize + 2 * halfSize;
+
+    // Reserve address space only, nothing is committed until it is touched
+    void *reserved = mmap(nullptr,mReservedSize,PROT_NONE,MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,-1,0);
+
+    if(reserved == MAP_FAILED)
+        throw std::runtime_error("Could not reserve memory for the tape");
+
+    mReserved = static_cast<char *>(reserved);
+
+    if(mprotect(mReserved + mGuardSize,2 * halfSize,PROT_READ | PROT_WRITE) != 0)
+    {
+
+        munmap(mReserved,mReservedSize);
+        throw std::runtime_error("Could not allocate memory for the tape");
+
+    }
+
+    #if defined(MADV_HUGEPAGE)
+
+    // Only a hint, the tape works the same without huge pages
+    if(hugePages)
+        madvise(mReserved + mGuardSize,2 * halfSize,MADV_HUGEPAGE);
+
+    #else
+
+    (void)hugePages;
+
+    #endif
+
+    mOrigin = mReserved + mGuardSize + halfSize;
+
+    installHandler();
+
+}
+
+
+Tape::~Tape()
+{
+
+    if(activeTape == this)
+        activeTape = nullptr;
+
+    munmap(mReserved,mReservedSize);
+
+}
+
+
+sigjmp_buf &Tape::arm()
+{
+
+    activeTape = this;
+
+    return mOverflow;
+
+}
+
+
+void Tape::leave()
+{
+
+    siglongjmp(mOverflow,1);
+
+}
+
+
+bool Tape::inGuard(const void *address) const
+{
+
+    const char *byte = static_cast<const char *>(address);
+
+    return (byte >= mReserved && byte < mReserved + mGuardSize)
+           || (byte >= mReserved + mReservedSize - mGuardSize && byte < mReserved + mReservedSize);
+
+}
+
+
+void Tape::installHandler()
+{
+
+    // Function local statics are initialized once, even with several threads
+    static const bool installed = []()
+    {
+
+        struct sigaction action;
+        std::memset(&action,0,sizeof(action));
+        action.sa_sigaction = faultHandler;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+
+        return sigaction(SIGSEGV,&action,&previousAction) == 0;
+
+    }();
+
+    (void)installed;
+
+}
+
+
+void Tape::faultHandler(int signal,siginfo_t *info,void *context)
+{
+
+    if(activeTape && activeTape->inGuard(info->si_addr))
+        siglongjmp(activeTape->mOverflow,1);
+
+    // Not a tape overflow, fall back to the previous handler
+    if(previousAction.sa_flags & SA_SIGINFO)
+        previousAction.sa_sigaction(signal,info,context);
+
+    else
+    {
+
+        sigaction(SIGSEGV,&previousAction,nullptr);
+        // The faulting instruction runs again and takes the default action
+
+    }
+
+}
@@ -0,0 +1,66 @@
+#ifndef TAPE_HPP
+#define TAPE_HPP
+
+#include <cstddef>
+#include <setjmp.h>
+#include <signal.h>
+
+/*
+
+Cell memory reserved with mmap. The origin is in the middle, so the program can
+move left and right of the starting cell. Pages are committed by the kernel on
+first touch and inaccessible guard pages at both ends turn overruns into a fault,
+which is reported as "Tape overflow" by the engine that armed the tape.
+
+*/
+class Tape
+{
+
+public:
+
+    /*
+
+    cells - number of cells on each side of the origin
+    guardCells - minimum size of each guard region in cells, must cover the largest
+                 distance the code can jump between two cell accesses
+
+    */
+    Tape(std::size_t cells,std::size_t cellSize,std::size_t guardCells,bool hugePages);
+    ~Tape();
+
+    Tape(const Tape &) = delete;
+    Tape &operator=(const Tape &) = delete;
+
+    template <typename CellType>
+    CellType *origin() const { return static_cast<CellType *>(mOrigin); }
+
+    /*
+
+    Makes this tape the active tape of the calling thread and returns the jump buffer
+    a guard page fault returns to. Use as:
+
+        if(sigsetjmp(tape.arm(),1))
+            throw std::runtime_error("Tape overflow");
+
+    */
+    sigjmp_buf &arm();
+
+    // Jumps back to where the tape was armed the way a guard page fault does, to stop a run from anywhere in the engine
+    [[noreturn]] void leave();
+
+private:
+
+    bool inGuard(const void *address) const;
+
+    static void installHandler();
+    static void faultHandler(int signal,siginfo_t *info,void *context);
+
+    char *mReserved;
+    std::size_t mReservedSize;
+    std::size_t mGuardSize;
+    void *mOrigin;
+    sigjmp_buf mOverflow;
+
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "Watchdog.hpp"
+#include <algorithm>
+#include <climits>
+#include <cerrno>
+#include <poll.h>
+
+namespace
+{
+
+// Budget sizes with a time limit, the smallest is where a run starts
+const std::uint64_t minGrant = 1;
+const std::uint64_t maxGrant = std::uint64_t(1) << 30;
+
+}
+
+
+Watchdog::Watchdog(std::uint64_t maxSteps,double timeout,Tape &tape)
+    :mTape(tape),mStepLimited(maxSteps != 0),mStepsLeft(maxSteps),mTimeLimited(timeout > 0),
+    mLastRefill(Clock::now()),mGrant(timeout > 0 ? minGrant : ~std::uint64_t(0)),mExceeded(nullptr)
+{
+
+    // Longer timeouts would overflow the clock, a run does not get to see them end anyway
+    const double seconds = std::min(timeout,1e9);
+
+    mDeadline = mLastRefill + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+
+}
+
+
+std::uint64_t Watchdog::refill(std::uint64_t shortfall)
+{
+
+    if(mStepLimited)
+    {
+
+        if(shortfall > mStepsLeft)
+            stop("Step limit exceeded");
+
+        mStepsLeft -= shortfall;
+
+    }
+
+    if(mTimeLimited)
+    {
+
+        const Clock::time_point now = Clock::now();
+
+        if(now >= mDeadline)
+            stop("Time limit exceeded");
+
+        // Steps cost anything from a cycle to a long scan, the budget follows what they took last time
+        if(now - mLastRefill < std::chrono::microseconds(500))
+            mGrant = std::min(mGrant * 2,maxGrant);
+
+        else if(now - mLastRefill > std::chrono::milliseconds(2))
+            mGrant = std::max(mGrant / 2,minGrant);
+
+        mLastRefill = now;
+
+    }
+
+    if(!mStepLimited)
+        return mGrant;
+
+    const std::uint64_t grant = std::min(mGrant,mStepsLeft);
+    mStepsLeft -= grant;
+
+    return grant;
+
+}
+
+
+/*
+
+Blocked on input a run spends no steps, so refill would never see the deadline.
+The wait is cut short at the deadline instead, errors are left to the read that follows.
+
+*/
+void Watchdog::waitReadable(int fd)
+{
+
+    if(!mTimeLimited)
+        return;
+
+    pollfd request = {fd,POLLIN,0};
+
+    while(true)
+    {
+
+        const Clock::time_point now = Clock::now();
+
+        if(now >= mDeadline)
+            stop("Time limit exceeded");
+
+        // Rounded up, waking before the deadline would only poll again
+        const std::int64_t left = (mDeadline - now) / std::chrono::milliseconds(1) + 1;
+        const int result = poll(&request,1,static_cast<int>(std::min<std::int64_t>(left,INT_MAX)));
+
+        if(result > 0 || (result < 0 && errno != EINTR))
+            return;
+
+    }
+
+}
+
+
+void Watchdog::stop(const char *message)
+{
+
+    mExceeded = message;
+    mTape.leave();
+
+}
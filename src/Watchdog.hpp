@@ -0,0 +1,69 @@
+#ifndef WATCHDOG_HPP
+#define WATCHDOG_HPP
+
+#include <chrono>
+#include <stdexcept>
+#include <cstdint>
+#include "Tape.hpp"
+
+// Thrown by a run stopped by its step or time limit
+class LimitExceeded : public std::runtime_error
+{
+
+public:
+
+    using std::runtime_error::runtime_error;
+
+};
+
+/*
+
+Step and time limits of a run. A step is a taken back edge, folded loops spend the
+back edges they replace from the count the engine computes anyway (scans and counted
+loops), so every optimization level takes the same steps. The engine spends its steps from a budget it keeps in a register and only calls refill
+when the budget runs out, refill checks both limits and hands out the next budget.
+With a time limit the budgets are sized so that the clock is read about once a
+millisecond, however long a step takes. A run waiting for input spends no steps,
+its reads wait at most until the deadline. A run over a limit leaves the engine
+through its tape, like a tape overflow does.
+
+*/
+class Watchdog
+{
+
+public:
+
+    // Zero for no limit, timeout in seconds
+    Watchdog(std::uint64_t maxSteps,double timeout,Tape &tape);
+
+    Watchdog(const Watchdog &) = delete;
+    Watchdog &operator=(const Watchdog &) = delete;
+
+    // The engine needs shortfall steps more than its budget had left, returns the next budget
+    std::uint64_t refill(std::uint64_t shortfall);
+    // Waits until fd has input, or stops the run when the time limit passes first
+    void waitReadable(int fd);
+
+    // Message of the limit that stopped the run, null when none did
+    const char *exceeded() const { return mExceeded; }
+
+private:
+
+    typedef std::chrono::steady_clock Clock;
+
+    [[noreturn]] void stop(const char *message);
+
+    Tape &mTape;
+    bool mStepLimited;
+    // Steps not handed out yet
+    std::uint64_t mStepsLeft;
+    bool mTimeLimited;
+    Clock::time_point mDeadline;
+    Clock::time_point mLastRefill;
+    // Size of the next budget
+    std::uint64_t mGrant;
+    const char *mExceeded;
+
+};
+
+#endif